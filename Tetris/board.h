@@ -5,60 +5,47 @@
 #include <queue>
 #include <glad/glad.h>
 #include <vector>
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <ctime>
 #include <iostream>
 #include "block.h"
+#include "gamecore.h"
 #include "config.h"
 
-/*
-
-    Desc: Contains All Given Shapes We Can Expect To Drop And Utilize
-    In A Given Game Of Tetris.
-
-*/
-static const std::vector<std::vector<bool>> shapes[] =
-{
-
-    { {1, 1, 1, 1} },           // I Shape
-    { {1, 1}, {1, 1} },         // O Shape
-    { {0, 1, 0}, {1, 1, 1} },   // T Shape
-    { {1, 1, 0}, {0, 1, 1} },   // S Shape
-    { {0, 1, 1}, {1, 1, 0} },   // Z Shape
-    { {1, 0, 0}, {1, 1, 1} },   // L Shape
-    { {0, 0, 1}, {1, 1, 1} }    // J Shape
-
-};
-
 
 
 /*
 
     Desc: Class Is Utilized To Contain All Data Pertaining To
-    The Visual, As Well As Logistical Pieces Of Our Game Of Tetris.
+    The Visual Pieces Of Our Game Of Tetris. The Rules Themselves
+    Live In This->core (tetris_core); The Board Forwards Player Input
+    To It And Mirrors Every State Change It Reports Onto The GPU. Like
+    Its GameCore, It Is Templated On The Board Dimensions.
 
 */
-class Board
+template <unsigned int Rows, unsigned int Cols>
+class Board : public CoreListener
 {
 
     private:
 
         // Current Game Of Tetris
-        Block** gameGrid;
-        std::vector<std::vector<bool>> upcomingShape;
-        unsigned int activePieceRow, activePieceCol; // Position Of The Active Piece On The Board
-        glm::vec3 activePieceColor;                  // Color Of The Active Piece
+        GameCore<Rows, Cols> core;
+        std::array<Block, Rows * Cols> gameGrid;     // Row-Major
         unsigned int& score;
         unsigned int& totalRowsCleared;
         unsigned int& level;
 
         // Window Displaying Next Up Shape
-        Block** previewGrid;
+        std::array<Block, CONFIG::PREVIEW_ROWS * CONFIG::PREVIEW_COLS> previewGrid;
         unsigned int previewGridIndices;            // Indices For Preview Grid Lines
         unsigned int previewCellIndices;            // Indices For Preview Cells
-        std::vector<std::vector<bool>> nextShape;
-        glm::vec3 nextShapeColor;
+        unsigned int nextPiece;                     // Index Into PIECE_TABLE Of The Next Piece
+        Cell nextShapeCell;                         // What Each Block Of The Next Piece Is Drawn As
 
         // Tetris Game Window Sizing
-        unsigned int rows, cols;
         unsigned int width, height;                 // Width And Height Of The Board In Pixels
 
         // Rendering 
@@ -69,191 +56,94 @@ class Board
         unsigned int gridLineIndices;               // Indices For Grid Lines
         unsigned int cellIndices;                   // Indices For All Blocks
 
+        // Batched Uploads
+        std::vector<unsigned int> dirtyCells;       // vboOffsets Of Cells Recolored Since The Last Flush
+        bool allCellsDirty;                         // If dirtyCells Overflowed, Upload Every Cell Instead
+        unsigned int firstCellVertex;               // First Vertex Of The Cells (Start Of A Full Upload)
+        unsigned int uploadCount;                   // glBufferSubData Calls Issued By The Last Flush
+
         // Update Flags
         bool& updateText;
         bool& gameOver;
 
 
-        /*
-
-            Desc: Randomly Selects One Of Our Available Shapes To Be The
-            Next Shape To Come Up After The Current Shape Is Dropped
-            (Next In The previewGrid) It Also Will Randomly Select A Color
-            For It
-
-            Preconditions:
-                1.) None
-
-            Postconditions:
-                1.) This->nextShape Will Be Now A Random Shape From shapes
-                2.) This->nextShape Will Be Colored A Random Color
-
-
-        */
-        void generateNextShape()
-        {
-        
-            auto tmp = shapes[std::rand() % 7];
-            nextShape = std::vector<std::vector<bool>>(tmp.begin(), tmp.end());
-            nextShapeColor = glm::vec3((std::rand() % 256) / 255.0f, (std::rand() % 256) / 255.0f, (std::rand() % 256) / 255.0f);
-        
-        }
-
+    public:
 
         /*
 
-            Desc: Function Will Swap Out The Shape Shown In This->previewGrid To Now
-            Be The Active Shape Being Dropped On The Tetris Game Checking If We
-            Have A Game Over Based On If It Is Able To Place The Given Shape
-            On The Grid. Likewise, Will Render The Ghost Piece For The Given Shape.
+            Desc: Takes In The Sizing Of Our Game Of Tetris; Also The Parent References To Our Top-Level Window's
+            Members For Updating Game State. The Piece Stream Is Seeded From seed,
+            Which Defaults To The Current Time.
 
             Preconditions:
-                1.) This->nextShape Contains A Given Shape
-                2.) This->gameGrid Is Initialized
+                1.) Width And Height Are Valid Screen Dimensions.
+                2.) Reference Parameters Are Valid And Accessible.
 
             Postconditions:
-                1.) Will Swap Out This->nextShape To Active, This->upcomingShape
-                2.) This->nextShape Will Be Set To A New Shape, Updating This->previewGrid
-                3.) If Game Isn't Over, Will Color Origin With This->upcomingShape
-                4.) If Game Isn't Over, Will Render Ghost Piece
-                5.) If Game Is Over, Will Return False And Update Parent's Flag
-                6.) If Game Isn't Over, Will Return True
+                1.) Initializes Game Grid And Preview Grid With Proper Dimensions.
+                2.) Sets Up References To Parent Window's Game State Variables.
+                3.) This->core Deals Its Pieces From seed.
+                4.) Attaches Itself As This->core's Listener.
 
         */
-        bool startNewPiece()
+        Board(unsigned int width, unsigned int height
+            , unsigned int& score, bool& textUpdate, unsigned int& linesCleared, unsigned int& curLevel, bool& gameOverFlag
+            , std::uint64_t seed = static_cast<std::uint64_t>(std::time(nullptr)))
+            : core(seed), score(score), updateText(textUpdate),
+            nextPiece(0), nextShapeCell(EMPTY_CELL), width(width), height(height), boardVBO(0), boardEBO(0),
+            boardIndices(0), gridLineIndices(0), cellIndices(0), allCellsDirty(false), firstCellVertex(0), uploadCount(0), totalRowsCleared(linesCleared),
+            level(curLevel), gameOver(gameOverFlag), previewGridIndices(0), previewCellIndices(0)
         {
 
-            // Move Next Shape To Current
-            upcomingShape = nextShape;
-            activePieceColor = nextShapeColor;
-
-            // Generate New Next Shape
-            generateNextShape();
-            updatePreviewDisplay();
-
-            // Set Starting Position (Center Top)
-            activePieceRow = 0;
-            activePieceCol = cols / 2 - upcomingShape[0].size() / 2;
-
-            // Check If We Can Place The New Shape (Game Over Check)
-            for (unsigned int i = 0; i < upcomingShape.size(); ++i) {
-                for (unsigned int j = 0; j < upcomingShape[i].size(); ++j) {
-                    if (upcomingShape[i][j])
-                    {
-                        unsigned int targetRow = activePieceRow + i;
-                        unsigned int targetCol = activePieceCol + j;
-
-                        if (targetRow >= rows || targetCol >= cols ||
-                            gameGrid[targetRow][targetCol].occupied == OCCUPIED)
-                        {
-                            // Game Over
-                            gameOver = true;
-                            return false;
-                        }
-                    }
-                }
-            }
+            // Every Cell Starts Empty Until initialize() Places It In The VBO
+            gameGrid.fill({ 0, 0, EMPTY_CELL });
+            previewGrid.fill({ 0, 0, EMPTY_CELL });
 
-            // Place The New Shape On Board
-            for (unsigned int i = 0; i < upcomingShape.size(); ++i) {
-                for (unsigned int j = 0; j < upcomingShape[i].size(); ++j) {
-                    if (upcomingShape[i][j])
-                    {
-                        setCellColor(activePieceRow + i, activePieceCol + j, activePieceColor);
-                    }
-                }
-            }
-
-            // Generate Ghost Piece
-            ghostPiece();
-            return true;
+            // Start Watching The Core
+            core.setListener(this);
 
         }
 
 
-    public:
-
         /*
 
-            Desc: Takes In The Amount Of Rows And Columns Our Game Of Tetris Will Use
-            As Well As The Sizing; Also The Parent References To Our Top-Level Window's
-            Members For Updating Game State.
+            Desc: Used For Resetting The Entire Game State (Mainly To Be Utilized As
+            A Cleanup Routine For After Game Over Happens) It Will Clear The Game Grid,
+            As Well As The Next Upcoming Shape
 
             Preconditions:
-                1.) Rows And Cols Are Valid Positive Integers For Grid Dimensions.
-                2.) Width And Height Are Valid Screen Dimensions.
-                3.) Reference Parameters Are Valid And Accessible.
+                1.) Should Be Called After Game Over Occurs
 
             Postconditions:
-                1.) Initializes Game Grid And Preview Grid With Proper Dimensions.
-                2.) Sets Up References To Parent Window's Game State Variables.
-                3.) Seeds Random Number Generator For Shape Generation.
-                4.) Generates Initial Next Shape For Preview Display.
+                1.) Will Reset This->core (And So The Drawn Grid) To Default
+                2.) Clears Out The Current Active Piece To Be Dropped
+                3.) Will Grab A Upcoming Shape For Next Game For Preview Window (This->nextPiece)
 
         */
-        Board(unsigned int rows, unsigned int cols, unsigned int width, unsigned int height
-            , unsigned int& score, bool& textUpdate, unsigned int& linesCleared, unsigned int& curLevel, bool& gameOverFlag)
-            : score(score), updateText(textUpdate),
-            rows(rows), cols(cols), width(width), height(height), boardVBO(0), boardEBO(0),
-            boardIndices(0), gridLineIndices(0), cellIndices(0), totalRowsCleared(linesCleared),
-            level(curLevel), gameOver(gameOverFlag), previewGridIndices(0), previewCellIndices(0)
+        void reset()
         {
 
-            // Seed Our Random Number Generator
-            std::srand(static_cast<unsigned int>(std::time(nullptr)));
-
-            // Initialize Our Main Game Grid
-            gameGrid = new Block * [rows];
-            for (unsigned int i = 0; i < rows; ++i) {
-                gameGrid[i] = new Block[cols];
-                for (unsigned int j = 0; j < cols; ++j) {
-                    gameGrid[i][j] = { 0, 0, EMPTY };
-                }
-            }
-
-            // Initialize Preview Grid
-            previewGrid = new Block * [CONFIG::PREVIEW_ROWS];
-            for (unsigned int i = 0; i < CONFIG::PREVIEW_ROWS; ++i) {
-                previewGrid[i] = new Block[CONFIG::PREVIEW_COLS];
-                for (unsigned int j = 0; j < CONFIG::PREVIEW_COLS; ++j) {
-                    previewGrid[i][j] = { 0, 0, EMPTY };
-                }
-            }
-
-            // Generate The First Shape
-            generateNextShape();
+            core.reset();
 
         }
 
 
         /*
 
-            Desc: Used For Resetting The Entire Game State (Mainly To Be Utilized As
-            A Cleanup Routine For After Game Over Happens) It Will Clear The Game Grid,
-            As Well As The Next Upcoming Shape
+            Desc: Resets Like reset(), But Restarts The Piece Stream From seed So The
+            Next Game Deals The Same Pieces As Any Other Game Started From seed.
 
             Preconditions:
-                1.) Should Be Called After Game Over Occurs
+                1.) None
 
             Postconditions:
-                1.) Will Reset This->gameGrid To Default
-                2.) Clears Out The Current Upcoming Shape To Be Dropped (This->upcomingShape)
-                3.) Will Grab A Upcoming Shape For Next Game For Preview Window (This->nextShape)
+                1.) This->core Is Reset And Reseeded With seed.
 
         */
-        void reset()
+        void reset(std::uint64_t seed)
         {
-            // Reset The Game Grid
-            for (unsigned int i = 0; i < rows; ++i) {
-                for (unsigned int j = 0; j < cols; ++j) {
-                    gameGrid[i][j] = { 0, 0, EMPTY };
-                }
-            }
-            // Clear The Upcoming Shape
-            upcomingShape.clear();
 
-            // Generate New Next Shape
-            generateNextShape();
+            core.reset(seed);
 
         }
 
@@ -266,7 +156,7 @@ class Board
             Look Grid-Like.
 
             Preconditions:
-                1.) This->width, This->height, This->cols & This->rows Are Initialized
+                1.) This->width & This->height Are Initialized
 
             Postconditions:
                 1.) Will Bind Up This->boardVAO, This->boardVBO & This->boardEBO
@@ -283,8 +173,8 @@ class Board
             float boardY = 0.0f;
 
             // Calculate Grid Cell Dimensions
-            float cellWidth = boardWidth / cols;
-            float cellHeight = boardHeight / rows;
+            float cellWidth = boardWidth / Cols;
+            float cellHeight = boardHeight / Rows;
 
             // Calculate The Starting Position (Top-Left Of The Board)
             float startX = boardX - boardWidth / 2.0f;
@@ -341,7 +231,7 @@ class Board
             baseIndex = 4;     // We Used 4 Vertices For The Board
 
             // Vertical Grid Lines
-            for (unsigned int i = 0; i <= cols; i++) {
+            for (unsigned int i = 0; i <= Cols; i++) {
                 float x = startX + i * cellWidth;
 
                 // Top Vertex Of The Line
@@ -368,7 +258,7 @@ class Board
             }
 
             // Horizontal Grid Lines
-            for (unsigned int i = 0; i <= rows; i++) {
+            for (unsigned int i = 0; i <= Rows; i++) {
                 float y = startY - i * cellHeight;
 
                 // Left Vertex Of The Line
@@ -394,13 +284,14 @@ class Board
                 baseIndex += 2;
             }
 
-            gridLineIndices = (cols + 1) * 2 + (rows + 1) * 2;  // Two Indices Per Line
+            gridLineIndices = (Cols + 1) * 2 + (Rows + 1) * 2;  // Two Indices Per Line
+            firstCellVertex = vertices.size() / 6;
 
             // 3. Generate Cells For Each Grid Position
             float cellPadding = 0.005f;  // Small Padding To See The Grid Lines
 
-            for (unsigned int row = 0; row < rows; row++) {
-                for (unsigned int col = 0; col < cols; col++) {
+            for (unsigned int row = 0; row < Rows; row++) {
+                for (unsigned int col = 0; col < Cols; col++) {
                     // Calculate Cell Position With Padding
                     float cellX = startX + col * cellWidth + cellPadding;
                     float cellY = startY - row * cellHeight - cellPadding;
@@ -411,8 +302,8 @@ class Board
                     float r = 0.0f, g = 0.0f, b = 0.0f;
 
                     // Store Where This Cell's Vertices Begin In The VBO
-                    gameGrid[row][col].vboOffset = vertices.size() / 6;  // 6 Floats Per Vertex
-                    gameGrid[row][col].indexOffset = indices.size();
+                    gameGrid[row * Cols + col].vboOffset = vertices.size() / 6;  // 6 Floats Per Vertex
+                    gameGrid[row * Cols + col].indexOffset = indices.size();
 
                     // Bottom-Left
                     vertices.push_back(cellX);
@@ -458,7 +349,7 @@ class Board
                 }
             }
 
-            cellIndices = rows * cols * 6;  // 6 Indices Per Cell
+            cellIndices = Rows * Cols * 6;  // 6 Indices Per Cell
 
             // Create VBO And EBO For Board
             glGenBuffers(1, &boardVBO);
@@ -472,7 +363,12 @@ class Board
             glBufferData(GL_ARRAY_BUFFER, vertices.size() * sizeof(float), vertices.data(), GL_DYNAMIC_DRAW);
             glBufferData(GL_ELEMENT_ARRAY_BUFFER, indices.size() * sizeof(unsigned int), indices.data(), GL_STATIC_DRAW);
 
-            // Now It's Safe To Update Preview (Uses glBufferSubData On An Allocated Buffer)
+            // Room For Every Cell Changing Several Times Before A Flush
+            dirtyCells.clear();
+            dirtyCells.reserve((Rows * Cols + CONFIG::PREVIEW_ROWS * CONFIG::PREVIEW_COLS) * CONFIG::DIRTY_CELLS_PER_CELL);
+            allCellsDirty = false;
+
+            // Now It's Safe To Update Preview (Queued Until The Next flushCellUploads)
             this->updatePreviewDisplay();
 
         }
@@ -644,8 +540,8 @@ class Board
                     float cellH = cellHeight - 2 * cellPadding;
 
                     // Store Preview Cell Offsets
-                    previewGrid[row][col].vboOffset = vertices.size() / 6;
-                    previewGrid[row][col].indexOffset = indices.size();
+                    previewGrid[row * CONFIG::PREVIEW_COLS + col].vboOffset = vertices.size() / 6;
+                    previewGrid[row * CONFIG::PREVIEW_COLS + col].indexOffset = indices.size();
 
                     // Default Transparent Color
                     float r = 0.0f, g = 0.0f, b = 0.0f;
@@ -698,64 +594,45 @@ class Board
 
         /*
 
-            Desc: Sets The Color Of A Specific Cell In The Preview Grid And Updates
-            The GPU Buffer With The New Color Information.
+            Desc: Draws A Specific Cell Of The Preview Grid As cell, Deriving Its
+            Vertex Colors From The Palette.
 
             Preconditions:
                 1.) Row And Column Are Within Valid Preview Grid Bounds.
                 2.) OpenGL Context Is Active And Buffer Objects Are Created.
-                3.) Color Values Are In Valid Range [0.0f, 1.0f].
 
             Postconditions:
-                1.) Updates The Color Of All Four Vertices For The Specified Preview Cell.
-                2.) Uploads The Color Changes To The GPU Buffer Immediately.
+                1.) The Preview Cell Holds cell And Its Four Vertices Are Recolored.
+                2.) Queues The Cell To Be Uploaded By The Next flushCellUploads.
                 3.) If Invalid Coordinates, Function Returns Without Changes.
 
         */
-        void setPreviewCellColor(unsigned int row, unsigned int col, const glm::vec3& color)
+        void drawPreviewCell(unsigned int row, unsigned int col, Cell cell)
         {
 
             if (row >= CONFIG::PREVIEW_ROWS || col >= CONFIG::PREVIEW_COLS) return;
 
-            // Each Preview Cell Has 4 Vertices, Each Vertex Has 6 Floats (x,y,z,r,g,b)
-            unsigned int vboStart = previewGrid[row][col].vboOffset;
-
-            // Update The Color In The VBO For All 4 Vertices Of This Cell
-            for (int i = 0; i < 4; i++) {
-                unsigned int colorOffset = (vboStart + i) * 6 + 3; // +3 To Skip x,y,z
-                vertices[colorOffset] = color.r;
-                vertices[colorOffset + 1] = color.g;
-                vertices[colorOffset + 2] = color.b;
-            }
-
-            // Upload The Updated Colors To The GPU
-            glBindBuffer(GL_ARRAY_BUFFER, boardVBO);
-            glBufferSubData(GL_ARRAY_BUFFER, vboStart * 6 * sizeof(float),
-                4 * 6 * sizeof(float), &vertices[vboStart * 6]);
-            glBindBuffer(GL_ARRAY_BUFFER, 0);
+            drawBlock(previewGrid[row * CONFIG::PREVIEW_COLS + col], cell);
 
         }
 
 
         /*
 
-            Desc: Clears A Specific Cell In The Preview Grid By Setting Its Color To Black
-            And Marking It As Empty.
+            Desc: Clears A Specific Cell In The Preview Grid, Drawing It As An Empty Cell.
 
             Preconditions:
                 1.) Row And Column Are Within Valid Preview Grid Bounds.
                 2.) Preview Grid Is Properly Initialized.
 
             Postconditions:
-                1.) Sets The Specified Preview Cell Color To Black (0.0f, 0.0f, 0.0f).
-                2.) Marks The Cell's Occupation Status As EMPTY.
+                1.) The Specified Preview Cell Is EMPTY_CELL And Drawn Black.
 
         */
         void clearPreviewCell(unsigned int row, unsigned int col) 
         {
 
-            setPreviewCellColor(row, col, glm::vec3(0.0f, 0.0f, 0.0f));
-            previewGrid[row][col].occupied = EMPTY;
+            drawPreviewCell(row, col, EMPTY_CELL);
 
         }
 
@@ -797,9 +674,10 @@ class Board
                 3.) Vertex Attributes Are Properly Configured.
 
             Postconditions:
-                1.) Draws Board Background, Grid Lines, And All Game Cells.
-                2.) Renders The Preview Window With Its Grid And Cells.
-                3.) All Visual Elements Are Displayed On Screen.
+                1.) Uploads Any Queued Cell Color Changes To This->boardVBO.
+                2.) Draws Board Background, Grid Lines, And All Game Cells.
+                3.) Renders The Preview Window With Its Grid And Cells.
+                4.) All Visual Elements Are Displayed On Screen.
 
         */
         void render() 
@@ -808,6 +686,9 @@ class Board
             glBindBuffer(GL_ARRAY_BUFFER, boardVBO);
             glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, boardEBO);
 
+            // Push Every Cell Changed Since Our Last Frame
+            flushCellUploads();
+
             glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, 6 * sizeof(float), (void*)0);
             glVertexAttribPointer(1, 3, GL_FLOAT, GL_FALSE, 6 * sizeof(float), (void*)(3 * sizeof(float)));
 
@@ -843,8 +724,8 @@ class Board
 
             Preconditions:
                 1.) Preview Grid Is Initialized And Functional.
-                2.) nextShape Contains A Valid Tetris Shape.
-                3.) nextShapeColor Contains A Valid Color.
+                2.) nextPiece Indexes A Valid Tetris Shape.
+                3.) nextShapeCell Holds A Valid Palette Index.
 
             Postconditions:
                 1.) Clears All Cells In The Preview Grid.
@@ -856,33 +737,20 @@ class Board
         {
     
             // Clear All Preview Cells First
-            for (unsigned int i = 0; i < CONFIG::PREVIEW_ROWS; ++i) {
-                for (unsigned int j = 0; j < CONFIG::PREVIEW_COLS; ++j) {
-                    // Just Like clearCell Does For The Main Grid
-                    setPreviewCellColor(i, j, glm::vec3(0.0f, 0.0f, 0.0f));
-                    previewGrid[i][j].occupied = EMPTY;
-                }
-            }
+            clearPreviewGrid();
 
-            nextShape = shapes[std::rand() % 7]; // Randomly Select A New Shape
-
-            // Skip If No Next Shape
-            if (!nextShape.empty()) {
-                // Center The Shape In The Preview Grid
-                unsigned int startRow = (CONFIG::PREVIEW_ROWS - nextShape.size()) / 2;
-                unsigned int startCol = (CONFIG::PREVIEW_COLS - nextShape[0].size()) / 2;
-
-                // Set Colors For The Next Shape Cells
-                for (unsigned int i = 0; i < nextShape.size(); ++i) {
-                    for (unsigned int j = 0; j < nextShape[i].size(); ++j) {
-                        if (nextShape[i][j])
-                        {
-                            // Use nextShapeColor Instead Of Random Colors
-                            setPreviewCellColor(startRow + i, startCol + j, nextShapeColor);
-                            previewGrid[startRow + i][startCol + j].occupied = OCCUPIED;
-                        }
-                    }
-                }
+            const PieceRotation& nextShape = PIECE_TABLE.get(nextPiece, 0);
+
+            // Center The Shape In The Preview Grid
+            unsigned int startRow = (CONFIG::PREVIEW_ROWS - nextShape.height) / 2;
+            unsigned int startCol = (CONFIG::PREVIEW_COLS - nextShape.width) / 2;
+
+            // Set Colors For The Next Shape Cells
+            for (unsigned int cell = 0; cell < PIECE_CELLS; ++cell) {
+                unsigned int row = startRow + nextShape.cellRow[cell];
+                unsigned int col = startCol + nextShape.cellCol[cell];
+
+                drawPreviewCell(row, col, nextShapeCell);
             }
 
         }
@@ -890,72 +758,87 @@ class Board
 
         /*
 
-            Desc: Sets The Color Of A Specific Cell In The Main Game Grid And Updates
-            The GPU Buffer With The New Color Information.
+            Desc: Draws A Block As cell, Writing The Palette Color Of cell Into All
+            Four Of Its Vertices. Colors Only Ever Flow From Cells Into This->vertices,
+            Never Back Out.
 
             Preconditions:
-                1.) Row And Column Are Within Valid Game Grid Bounds.
-                2.) OpenGL Context Is Active And Buffer Objects Are Created.
-                3.) Color Values Are In Valid Range [0.0f, 1.0f].
+                1.) block Is A Game Or Preview Cell Placed In This->vertices.
 
             Postconditions:
-                1.) Updates The Color Of All Four Vertices For The Specified Game Cell.
-                2.) Uploads The Color Changes To The GPU Buffer Immediately.
-                3.) If Invalid Coordinates, Function Returns Without Changes.
+                1.) block.cell Is cell And Its Vertices Are Colored To Match.
+                2.) Queues The Block To Be Uploaded By The Next flushCellUploads.
 
         */
-        void setCellColor(unsigned int row, unsigned int col, const glm::vec3& color) 
+        void drawBlock(Block& block, Cell cell)
         {
 
-            if (row >= rows || col >= cols) return;
+            block.cell = cell;
+            const CellColor& color = cellColor(cell);
 
             // Each Cell Has 4 Vertices, Each Vertex Has 6 Floats (x,y,z,r,g,b)
             // Color Starts At Index 3 For Each Vertex
-            unsigned int vboStart = gameGrid[row][col].vboOffset;
-
-            // Update The Color In The VBO For All 4 Vertices Of This Cell
             for (int i = 0; i < 4; i++) {
-                unsigned int colorOffset = (vboStart + i) * 6 + 3; // +3 To Skip x,y,z
+                unsigned int colorOffset = (block.vboOffset + i) * 6 + 3; // +3 To Skip x,y,z
                 vertices[colorOffset] = color.r;
                 vertices[colorOffset + 1] = color.g;
                 vertices[colorOffset + 2] = color.b;
             }
 
-            // Upload The Updated Colors To The GPU
-            glBindBuffer(GL_ARRAY_BUFFER, boardVBO);
-            glBufferSubData(GL_ARRAY_BUFFER, vboStart * 6 * sizeof(float),
-                4 * 6 * sizeof(float), &vertices[vboStart * 6]);
-            glBindBuffer(GL_ARRAY_BUFFER, 0);
+            // Queue The Updated Colors For The Next Upload To The GPU
+            markCellDirty(block.vboOffset);
 
         }
 
 
         /*
 
-            Desc: Clears A Specific Cell In The Main Game Grid By Setting Its Color
-            To Black And Marking It As Empty.
+            Desc: Draws A Specific Cell Of The Main Game Grid As cell, Deriving Its
+            Vertex Colors From The Palette.
+
+            Preconditions:
+                1.) Row And Column Are Within Valid Game Grid Bounds.
+                2.) OpenGL Context Is Active And Buffer Objects Are Created.
+
+            Postconditions:
+                1.) The Game Cell Holds cell And Its Four Vertices Are Recolored.
+                2.) Queues The Cell To Be Uploaded By The Next flushCellUploads.
+                3.) If Invalid Coordinates, Function Returns Without Changes.
+
+        */
+        void drawCell(unsigned int row, unsigned int col, Cell cell) 
+        {
+
+            if (row >= Rows || col >= Cols) return;
+
+            drawBlock(gameGrid[row * Cols + col], cell);
+
+        }
+
+
+        /*
+
+            Desc: Clears A Specific Cell In The Main Game Grid, Drawing It As An Empty Cell.
 
             Preconditions:
                 1.) Row And Column Are Within Valid Game Grid Bounds.
                 2.) Game Grid Is Properly Initialized.
 
             Postconditions:
-                1.) Sets The Specified Game Cell Color To Black (0.0f, 0.0f, 0.0f).
-                2.) Marks The Cell's Occupation Status As EMPTY.
+                1.) The Specified Game Cell Is EMPTY_CELL And Drawn Black.
 
         */
         void clearCell(unsigned int row, unsigned int col) 
         {
     
-            setCellColor(row, col, glm::vec3(0.0f, 0.0f, 0.0f));
-            gameGrid[row][col].occupied = EMPTY;
+            drawCell(row, col, EMPTY_CELL);
     
         }
 
 
         /*
 
-            Desc: Colors Random Cells In The Game Grid With Different Colors For
+            Desc: Colors Random Cells In The Game Grid With Different Palette Colors For
             Testing And Demonstration Purposes.
 
             Preconditions:
@@ -963,7 +846,7 @@ class Board
                 2.) Cell Coloring Functions Are Working Correctly.
 
             Postconditions:
-                1.) Sets Specific Cells To Red, Green, Blue, And Yellow Colors.
+                1.) Sets Specific Cells To The First Four Piece Colors.
                 2.) Provides Visual Verification That Cell Coloring Is Functioning.
 
         */
@@ -971,10 +854,10 @@ class Board
         {
 
             // Color Some Cells For Testing
-            setCellColor(0, 0, glm::vec3(1.0f, 0.0f, 0.0f)); // Red
-            setCellColor(1, 2, glm::vec3(0.0f, 1.0f, 0.0f)); // Green
-            setCellColor(3, 5, glm::vec3(0.0f, 0.0f, 1.0f)); // Blue
-            setCellColor(5, 7, glm::vec3(1.0f, 1.0f, 0.0f)); // Yellow
+            drawCell(0, 0, makeCell(OCCUPIED, PALETTE_FIRST_PIECE));
+            drawCell(1, 2, makeCell(OCCUPIED, PALETTE_FIRST_PIECE + 1));
+            drawCell(3, 5, makeCell(OCCUPIED, PALETTE_FIRST_PIECE + 2));
+            drawCell(5, 7, makeCell(OCCUPIED, PALETTE_FIRST_PIECE + 3));
 
         }
 
@@ -982,7 +865,7 @@ class Board
         /*
 
             Desc: Retrieves The Current Color Of A Specific Cell In The Game Grid
-            From The Vertex Buffer Data.
+            By Looking Its Cell Up In The Palette.
 
             Preconditions:
                 1.) Row And Column Are Within Valid Game Grid Bounds.
@@ -996,16 +879,15 @@ class Board
         glm::vec3 getBlockColor(unsigned int row, unsigned int col) const 
         {
 
-            if (row >= rows || col >= cols) return glm::vec3(0.0f, 0.0f, 0.0f);
+            if (row >= Rows || col >= Cols) return glm::vec3(0.0f, 0.0f, 0.0f);
 
-            // Each Cell Has 4 Vertices, Each Vertex Has 6 Floats (x,y,z,r,g,b)
-            unsigned int vboStart = gameGrid[row][col].vboOffset;
-            // Get The Color From The First Vertex Of The Cell
-            return glm::vec3(vertices[vboStart * 6 + 3], vertices[vboStart * 6 + 4], vertices[vboStart * 6 + 5]);
+            const CellColor& color = cellColor(gameGrid[row * Cols + col].cell);
+            return glm::vec3(color.r, color.g, color.b);
 
         }
 
 
+
         /*
 
             Desc: Advances The Game State By One Step, Managing Active Piece Movement,
@@ -1013,442 +895,290 @@ class Board
 
             Preconditions:
                 1.) Game Grid Is Properly Initialized.
-                2.) Game State Variables Are Valid.
 
             Postconditions:
-                1.) Moves Active Piece Down One Row If Possible.
-                2.) Finalizes Piece Position And Checks For Completed Lines.
-                3.) Generates New Piece If Current Piece Has Landed.
-                4.) Handles Game Over Conditions If No New Piece Can Be Placed.
+                1.) This->core Is Stepped Once, Its Changes Drawn Through Our Listener Handlers.
 
         */
         void step()
         {
 
-            // If No Active Shape, Start A New One
-            if (upcomingShape.empty()) 
-            {
+            core.step();
 
-                if (!startNewPiece()) 
-                {
-                    // Game Over - Reset The Game
-                    std::cout << "Game Over!" << std::endl;
-                    for (unsigned int i = 0; i < rows; ++i) {
-                        for (unsigned int j = 0; j < cols; ++j) {
-                            clearCell(i, j);
-                        }
-                    }
-
-                    return;
-                }
-                return; // New Piece Placed, Wait For Next Step
-            }
+        }
 
-            // Try To Move Current Shape Down
-            bool canShiftDown = true;
-
-            // Check If Shape Can Move Down
-            for (unsigned int i = 0; i < upcomingShape.size(); ++i) {
-                for (unsigned int j = 0; j < upcomingShape[i].size(); ++j) {
-                    if (upcomingShape[i][j])
-                    {
-                        unsigned int targetRow = activePieceRow + i + 1;
-                        unsigned int targetCol = activePieceCol + j;
-
-                        if (targetRow >= rows || targetCol >= cols ||
-                            gameGrid[targetRow][targetCol].occupied == OCCUPIED) 
-                        {
-                            canShiftDown = false;
-                            break;
-                        }
-                    }
-                }
-                if (!canShiftDown) break;
-            }
 
-            if (canShiftDown)
-            {
-                // Move Shape Down
-
-                // Clear Current Position
-                for (unsigned int i = 0; i < upcomingShape.size(); ++i) {
-                    for (unsigned int j = 0; j < upcomingShape[i].size(); ++j) {
-                        if (upcomingShape[i][j])
-                        {
-                            clearCell(activePieceRow + i, activePieceCol + j);
-                        }
-                    }
-                }
+        /*
 
-                // Move Down
-                activePieceRow++;
-
-                // Draw In New Position
-                for (unsigned int i = 0; i < upcomingShape.size(); ++i) {
-                    for (unsigned int j = 0; j < upcomingShape[i].size(); ++j) {
-                        if (upcomingShape[i][j])
-                        {
-                            setCellColor(activePieceRow + i, activePieceCol + j, activePieceColor);
-                        }
-                    }
-                }
+            Desc: Moves The Currently Active Tetris Piece In The Specified Direction
+            With Collision Detection And Boundary Checking.
 
-                // Update Ghost Piece
-                ghostPiece();
-            }
-            else 
-            {
-                // Shape Has Landed - Finalize It
-
-                // Mark Cells As Occupied
-                for (unsigned int i = 0; i < upcomingShape.size(); ++i) {
-                    for (unsigned int j = 0; j < upcomingShape[i].size(); ++j) {
-                        if (upcomingShape[i][j])
-                        {
-                            gameGrid[activePieceRow + i][activePieceCol + j].occupied = OCCUPIED;
-                        }
-                    }
-                }
+            Preconditions:
+                1.) Direction Parameter Is Valid ('L', 'R', Or 'D').
 
-                // Clear The Active Shape So A New One Will Be Generated Next Step
-                upcomingShape.clear();
-
-                // Check For Completed Lines
-                checkForPoints();
-
-                // Clear Ghost Pieces
-                for (unsigned int i = 0; i < rows; ++i) {
-                    for (unsigned int j = 0; j < cols; ++j) {
-                        if (gameGrid[i][j].occupied == GHOST)
-                        {
-                            clearCell(i, j);
-                            gameGrid[i][j].occupied = EMPTY;
-                        }
-                    }
-                }
+            Postconditions:
+                1.) Moves Active Piece Left, Right, Or Fast Down If Movement Is Valid.
+                2.) If Movement Is Invalid Due To Collision, No Movement Occurs.
 
-            }
+        */
+        void shiftActivePiece(char direction)
+        {
+
+            core.shiftActivePiece(direction);
 
         }
 
 
         /*
 
-            Desc: Moves The Currently Active Tetris Piece In The Specified Direction
+            Desc: Rotates The Currently Active Tetris Piece 90 Degrees Clockwise
             With Collision Detection And Boundary Checking.
 
             Preconditions:
-                1.) An Active Piece (upcomingShape) Exists On The Board.
-                2.) Direction Parameter Is Valid ('L', 'R', Or 'D').
-                3.) Game Grid Is Properly Initialized.
+                1.) None
 
             Postconditions:
-                1.) Moves Active Piece Left, Right, Or Fast Down If Movement Is Valid.
-                2.) Updates Visual Display To Reflect New Piece Position.
-                3.) If Movement Is Invalid Due To Collision, No Movement Occurs.
+                1.) Rotates Active Piece If Rotation Is Valid And No Collisions Occur.
+                2.) If Rotation Is Invalid, Piece Remains In Original Orientation.
 
         */
-        void shiftActivePiece(char direction)
+        void rotateActivePiece()
         {
 
-            // User Shifts Left, Right, Or Fast Down
-            if (upcomingShape.empty()) 
+            core.rotateActivePiece();
+
+        }
+
+
+        /*
+
+            Desc: Creates And Displays A Ghost Piece That Shows Where The Active
+            Piece Will Land When Dropped Straight Down.
+
+            Preconditions:
+                1.) None
+
+            Postconditions:
+                1.) Ghost Piece Is Redrawn At The Active Piece's Landing Position.
+
+        */
+        void ghostPiece()
+        {
+
+            core.ghostPiece();
+
+        }
+
+
+        /*
+
+            Desc: Shows A Suggested Placement Of The Active Piece As Its Ghost.
+
+            Preconditions:
+                1.) (rotation, row, col) Is A Placement Of The Active Piece That Fits On The Board.
+
+            Postconditions:
+                1.) The Ghost Is Redrawn At The Hint Until The Piece Locks Or clearHint() Is Called.
+
+        */
+        void setHint(unsigned int rotation, unsigned int row, unsigned int col)
+        {
+
+            core.setHint(rotation, row, col);
+
+        }
+
+
+        /*
+
+            Desc: Drops Any Hint, Showing The Landing Position As The Ghost Again.
+
+            Preconditions:
+                1.) None
+
+            Postconditions:
+                1.) The Ghost Is Redrawn At The Active Piece's Landing Position.
+
+        */
+        void clearHint()
+        {
+
+            core.clearHint();
+
+        }
+
+
+        /*
+
+            Desc: Queues A Cell's Vertices To Be Uploaded On The Next Flush. If We've
+            Queued More Cells Than We Reserved Room For, We Stop Tracking Them One By
+            One And Upload All Cells Together Instead.
+
+            Preconditions:
+                1.) vboStart Is The vboOffset Of A Game Or Preview Cell.
+
+            Postconditions:
+                1.) The Cell Will Be Part Of The Next flushCellUploads.
+
+        */
+        void markCellDirty(unsigned int vboStart)
+        {
+
+            if (allCellsDirty) return;
+
+            if (dirtyCells.size() == dirtyCells.capacity())
             {
+                allCellsDirty = true;
                 return;
             }
 
-            bool canShift = true;
-            switch (direction)
-            {
-
-                case 'L': // Shift Left
-                    for (unsigned int i = 0; i < upcomingShape.size(); ++i) {
-                        for (unsigned int j = 0; j < upcomingShape[i].size(); ++j) {
-                            if (upcomingShape[i][j])
-                            {
-                                unsigned int targetRow = activePieceRow + i;
-                                unsigned int targetCol = activePieceCol + j - 1;
-                                // Check If The Target Cell Is Within Bounds And Not Occupied
-                                if (targetCol < 0 || targetCol >= cols || gameGrid[targetRow][targetCol].occupied == OCCUPIED)
-                                {
-                                    canShift = false;
-                                    break;
-                                }
-                            }
-                        }
-                        if (!canShift) break;
-                    }
-                    if (canShift)
-                    {
-                        // Clear The Current Shape From The Board
-                        for (unsigned int i = 0; i < upcomingShape.size(); ++i) {
-                            for (unsigned int j = 0; j < upcomingShape[i].size(); ++j) {
-                                if (upcomingShape[i][j])
-                                {
-                                    clearCell(activePieceRow + i, activePieceCol + j);
-                                }
-                            }
-                        }
-                        // Move The Shape Left
-                        activePieceCol--;
-                        // Draw The Shape In Its New Position
-                        for (unsigned int i = 0; i < upcomingShape.size(); ++i) {
-                            for (unsigned int j = 0; j < upcomingShape[i].size(); ++j) {
-                                if (upcomingShape[i][j])
-                                {
-
-                                    setCellColor(activePieceRow + i, activePieceCol + j, this->activePieceColor);
-                                }
-                            }
-                        }
-                    }
-                    break;
-                case 'R': // Shift Right
-                    for (unsigned int i = 0; i < upcomingShape.size(); ++i) {
-                        for (unsigned int j = 0; j < upcomingShape[i].size(); ++j) {
-                            if (upcomingShape[i][j])
-                            {
-                                unsigned int targetRow = activePieceRow + i;
-                                unsigned int targetCol = activePieceCol + j + 1;
-                                // Check If The Target Cell Is Within Bounds And Not Occupied
-                                if (targetCol >= cols || gameGrid[targetRow][targetCol].occupied == OCCUPIED)
-                                {
-                                    canShift = false;
-                                    break;
-                                }
-                            }
-                        }
-                        if (!canShift) break;
-                    }
-                    if (canShift)
-                    {
-                        // Clear The Current Shape From The Board
-                        for (unsigned int i = 0; i < upcomingShape.size(); ++i) {
-                            for (unsigned int j = 0; j < upcomingShape[i].size(); ++j) {
-                                if (upcomingShape[i][j])
-                                {
-                                    clearCell(activePieceRow + i, activePieceCol + j);
-                                }
-                            }
-                        }
-                        // Move The Shape Right
-                        activePieceCol++;
-                        // Draw The Shape In Its New Position
-                        for (unsigned int i = 0; i < upcomingShape.size(); ++i) {
-                            for (unsigned int j = 0; j < upcomingShape[i].size(); ++j) {
-                                if (upcomingShape[i][j])
-                                {
-                                    setCellColor(activePieceRow + i, activePieceCol + j, this->activePieceColor);
-                                }
-                            }
-                        }
-                    }
-                    break;
-                case 'D': // Fast Down
-                    while (true) {
-                        bool canShiftDown = true;
-                        for (unsigned int i = 0; i < upcomingShape.size(); ++i) {
-                            for (unsigned int j = 0; j < upcomingShape[i].size(); ++j) {
-                                if (upcomingShape[i][j])
-                                {
-                                    unsigned int targetRow = activePieceRow + i + 1;
-                                    unsigned int targetCol = activePieceCol + j;
-                                    // Check If The Target Cell Is Within Bounds And Not Occupied
-                                    if ((targetRow >= rows) || (targetCol >= cols) ||
-                                        (gameGrid[targetRow][targetCol].occupied == OCCUPIED))
-                                    {
-                                        canShiftDown = false; // Cannot Shift Down, Hit The Bottom Or Another Piece
-                                        break;
-                                    }
-                                }
-                            }
-                            if (!canShiftDown) break;
-                        }
-                        if (!canShiftDown) break;
-                        // Clear The Current Shape From The Board
-                        for (unsigned int i = 0; i < upcomingShape.size(); ++i) {
-                            for (unsigned int j = 0; j < upcomingShape[i].size(); ++j) {
-                                if (upcomingShape[i][j])
-                                {
-                                    clearCell(activePieceRow + i, activePieceCol + j);
-                                }
-                            }
-                        }
-                        // Move The Shape Down
-                        activePieceRow++;
-
-                    }
-
-                    // Draw The Shape In Its New Position
-                    for (unsigned int i = 0; i < upcomingShape.size(); ++i) {
-                        for (unsigned int j = 0; j < upcomingShape[i].size(); ++j) {
-                            if (upcomingShape[i][j])
-                            {
-                                // Set The Cell Color
-                                setCellColor(activePieceRow + i, activePieceCol + j, this->activePieceColor);
-                            }
-                        }
-                    }
-                    break;
-            }
+            dirtyCells.push_back(vboStart);
 
         }
 
 
         /*
 
-            Desc: Rotates The Currently Active Tetris Piece 90 Degrees Clockwise
-            With Collision Detection And Boundary Checking.
+            Desc: Uploads Every Cell Queued Since The Last Flush To This->boardVBO,
+            Merging Cells That Sit Close Together In The Buffer Into One
+            glBufferSubData So A Whole Tick Of Changes Costs Only A Few Calls.
 
             Preconditions:
-                1.) An Active Piece (upcomingShape) Exists On The Board.
-                2.) Game Grid Is Properly Initialized.
+                1.) This->boardVBO Is Bound To GL_ARRAY_BUFFER.
 
             Postconditions:
-                1.) Rotates Active Piece If Rotation Is Valid And No Collisions Occur.
-                2.) Updates Visual Display To Show Rotated Piece.
-                3.) If Rotation Is Invalid, Piece Remains In Original Orientation.
+                1.) This->boardVBO Matches This->vertices For Every Queued Cell.
+                2.) This->uploadCount Holds The Number Of Uploads Issued.
+                3.) The Dirty Queue Is Empty.
 
         */
-        void rotateActivePiece()
+        void flushCellUploads()
         {
 
-            if (upcomingShape.empty()) 
+            uploadCount = 0;
+
+            if (allCellsDirty)
             {
+                // Every Cell Through The End Of The Preview Grid In One Go
+                glBufferSubData(GL_ARRAY_BUFFER, firstCellVertex * 6 * sizeof(float),
+                    (vertices.size() - firstCellVertex * 6) * sizeof(float), &vertices[firstCellVertex * 6]);
+                uploadCount = 1;
+                allCellsDirty = false;
+                dirtyCells.clear();
                 return;
             }
 
-            // Create A New Rotated Shape
-            std::vector<std::vector<bool>> rotatedShape(upcomingShape[0].size(), std::vector<bool>(upcomingShape.size(), false));
+            if (dirtyCells.empty()) return;
 
-            for (unsigned int i = 0; i < upcomingShape.size(); ++i) {
-                for (unsigned int j = 0; j < upcomingShape[i].size(); ++j) {
-                    rotatedShape[j][upcomingShape.size() - 1 - i] = upcomingShape[i][j];
-                }
-            }
+            std::sort(dirtyCells.begin(), dirtyCells.end());
 
-            // Check If The Rotated Shape Can Fit In The Current Position
-            bool canRotate = true;
-            for (unsigned int i = 0; i < rotatedShape.size(); ++i) {
-                for (unsigned int j = 0; j < rotatedShape[i].size(); ++j) {
-                    if (rotatedShape[i][j])
-                    {
-                        unsigned int targetRow = activePieceRow + i;
-                        unsigned int targetCol = activePieceCol + j;
-                        // Check If The Target Cell Is Within Bounds And Not Occupied
-                        if (targetRow >= rows || targetCol >= cols || gameGrid[targetRow][targetCol].occupied == OCCUPIED)
-                        {
-                            canRotate = false;
-                            break;
-                        }
-                    }
+            // Grow A Run Of Vertices While The Next Cell Is Within The Allowed Gap
+            const unsigned int maxGap = CONFIG::MAX_UPLOAD_GAP_CELLS * 4;
+            unsigned int runStart = dirtyCells[0];
+            unsigned int runEnd = runStart + 4;
+            for (size_t i = 1; i <= dirtyCells.size(); ++i) {
+                if (i < dirtyCells.size() && dirtyCells[i] <= runEnd + maxGap)
+                {
+                    runEnd = std::max(runEnd, dirtyCells[i] + 4);
+                    continue;
                 }
-                if (!canRotate) break;
-            }
 
-            if (canRotate)
-            {
-                // Clear The Current Shape From The Board
-                for (unsigned int i = 0; i < upcomingShape.size(); ++i) {
-                    for (unsigned int j = 0; j < upcomingShape[i].size(); ++j) {
-                        if (upcomingShape[i][j])
-                        {
-                            clearCell(activePieceRow + i, activePieceCol + j);
-                        }
-                    }
-                }
-                // Update The Upcoming Shape To The Rotated Version
-                upcomingShape = rotatedShape;
-                // Draw The Rotated Shape In Its New Position
-                for (unsigned int i = 0; i < upcomingShape.size(); ++i) {
-                    for (unsigned int j = 0; j < upcomingShape[i].size(); ++j) {
-                        if (upcomingShape[i][j])
-                        {
-                            setCellColor(activePieceRow + i, activePieceCol + j, this->activePieceColor);
-                        }
-                    }
+                glBufferSubData(GL_ARRAY_BUFFER, runStart * 6 * sizeof(float),
+                    (runEnd - runStart) * 6 * sizeof(float), &vertices[runStart * 6]);
+                uploadCount++;
+
+                if (i < dirtyCells.size())
+                {
+                    runStart = dirtyCells[i];
+                    runEnd = runStart + 4;
                 }
             }
 
+            dirtyCells.clear();
+
         }
 
 
         /*
 
-            Desc: Creates And Displays A Ghost Piece That Shows Where The Active
-            Piece Will Land When Dropped Straight Down.
+            Desc: Returns How Many Buffer Uploads The Last Rendered Frame Needed.
 
             Preconditions:
-                1.) An Active Piece (upcomingShape) Exists On The Board.
-                2.) Game Grid Is Properly Initialized.
+                1.) None
 
             Postconditions:
-                1.) Clears Any Previous Ghost Piece From The Board.
-                2.) Calculates The Landing Position For The Active Piece.
-                3.) Displays Ghost Piece In Gray Color At The Landing Position.
-                4.) If Ghost Would Be Too Close To Active Piece, No Ghost Is Shown.
+                1.) Returns This->uploadCount.
 
         */
-        void ghostPiece()
+        unsigned int getUploadCount() const
         {
 
-            if (upcomingShape.empty())
-            {
-                return; // No Upcoming Shape, No Ghost Piece
-            }
+            return uploadCount;
 
-            // Create A Ghost Piece That Shows Where The Active Piece Would Land
-            unsigned int ghostRow = activePieceRow;
-            unsigned int ghostCol = activePieceCol;
-            // Move The Ghost Piece Down Until It Can't Go Further
-            while (true) {
-                // Check If The Ghost Piece Can Shift Down
-                bool canShiftDown = true;
-                for (unsigned int i = 0; i < upcomingShape.size(); ++i) {
-                    for (unsigned int j = 0; j < upcomingShape[i].size(); ++j) {
-                        if (upcomingShape[i][j])
-                        {
-                            unsigned int targetRow = ghostRow + i + 1;
-                            unsigned int targetCol = ghostCol + j;
-                            // Check If The Target Cell Is Within Bounds And Not Occupied
-                            if ((targetRow >= rows) || (targetCol >= cols) ||
-                                (gameGrid[targetRow][targetCol].occupied == OCCUPIED))
-                            {
-                                canShiftDown = false; // Cannot Shift Down, Hit The Bottom Or Another Piece
-                                break;
-                            }
-                        }
-                    }
-                    if (!canShiftDown) break;
-                }
-                if (!canShiftDown) break;
-                ghostRow++;
-            }
-            // Clear Any Previous Ghost Piece
-            for (unsigned int i = 0; i < rows; ++i) {
-                for (unsigned int j = 0; j < cols; ++j) {
-                    if (gameGrid[i][j].occupied == GHOST)
-                    {
-                        clearCell(i, j);
-                    }
-                }
-            }
+        }
 
-            if (ghostRow - activePieceRow < CONFIG::MIN_GHOST_DISTANCE)
-            {
-                // If The Ghost Piece Is Too Close To The Active Piece, Don't Draw It
-                return;
-            }
 
-            // Draw The Ghost Piece In Its Position
-            for (unsigned int i = 0; i < upcomingShape.size(); ++i) {
-                for (unsigned int j = 0; j < upcomingShape[i].size(); ++j) {
-                    if (upcomingShape[i][j])
-                    {
-                        setCellColor(ghostRow + i, ghostCol + j, glm::vec3(CONFIG::COLORS::GHOST_R, CONFIG::COLORS::GHOST_G, CONFIG::COLORS::GHOST_B)); // Gray Color For Ghost Piece
-                        gameGrid[ghostRow + i][ghostCol + j].occupied = GHOST; // Mark As Ghost
-                    }
-                }
+        /*
+
+            Desc: Gives Read-Only Access To The Underlying Game Rules And State.
+
+            Preconditions:
+                1.) None
+
+            Postconditions:
+                1.) Returns This->core.
+
+        */
+        const GameCore<Rows, Cols>& getCore() const
+        {
+
+            return core;
+
+        }
+
+
+        // Seed Of The Current Piece Stream
+        std::uint64_t getSeed() const { return core.getSeed(); }
+
+        // Zobrist Hash Of The Locked Cells; Equal Boards Hash Alike
+        std::uint64_t getHash() const { return core.getHash(); }
+
+
+        /*
+
+            Desc: CoreListener Handler; Redraws A Single Cell Of The Game Grid.
+
+            Preconditions:
+                1.) Row And Column Are Within Valid Game Grid Bounds.
+
+            Postconditions:
+                1.) The Cell Is Drawn As cell.
+
+        */
+        void onCellChanged(unsigned int row, unsigned int col, Cell cell) override
+        {
+
+            drawCell(row, col, cell);
+
+        }
+
+
+        /*
+
+            Desc: CoreListener Handler; Copies The Drawn Cells Of fromRow Into toRow.
+
+            Preconditions:
+                1.) Both Rows Are Within Valid Game Grid Bounds.
+
+            Postconditions:
+                1.) Every Cell Of toRow Is Drawn Like fromRow.
+
+        */
+        void onRowMoved(unsigned int fromRow, unsigned int toRow) override
+        {
+
+            for (unsigned int col = 0; col < Cols; ++col) {
+                drawBlock(gameGrid[toRow * Cols + col], gameGrid[fromRow * Cols + col].cell);
             }
 
         }
@@ -1456,100 +1186,110 @@ class Board
 
         /*
 
-            Desc: Checks For Completed Horizontal Lines, Clears Them, Shifts Remaining
-            Blocks Down, And Updates Score And Level Accordingly.
+            Desc: CoreListener Handler; Clears Every Cell Of A Row To Black.
 
             Preconditions:
-                1.) Game Grid Is Properly Initialized With Valid Block States.
-                2.) Score, Level, And Line Count References Are Valid.
+                1.) Row Is Within Valid Game Grid Bounds.
 
             Postconditions:
-                1.) Identifies And Clears All Completed Horizontal Lines.
-                2.) Shifts All Blocks Above Cleared Lines Down Appropriately.
-                3.) Updates Score Based On Number Of Lines Cleared.
-                4.) Increments Level Every 5 Lines Cleared.
-                5.) Sets Update Text Flag To Refresh UI Display.
+                1.) Every Cell Of row Is Black And EMPTY.
 
         */
-        void checkForPoints()
+        void onRowCleared(unsigned int row) override
         {
 
-            glm::vec3 oldColor;
-            bool rowCleared = false;
-            int rowsCleared = 0;
-
-            // Check For Completed Rows
-            for (unsigned int row = 0; row < rows; ++row) {
-                bool complete = true;
-                for (unsigned int col = 0; col < cols; ++col) {
-                    if (gameGrid[row][col].occupied == EMPTY)
-                    {
-                        complete = false;
-                        break;
-                    }
-                }
-                if (complete)
-                {
-                    rowCleared = true;
-                    rowsCleared++;
-
-                    // Clear The Completed Row
-                    for (unsigned int col = 0; col < cols; ++col) {
-                        clearCell(row, col);
-                        gameGrid[row][col].occupied = EMPTY;
-                    }
-
-                    // Shift All Rows Above Down
-                    for (int r = row - 1; r >= 0; --r) {
-                        for (unsigned int c = 0; c < cols; ++c) {
-                            if (gameGrid[r][c].occupied == OCCUPIED)
-                            {
-                                // Grab The Color Of The Cell Above
-                                oldColor = getBlockColor(r, c);
-                                clearCell(r, c);
-                                setCellColor(r + 1, c, oldColor);
-                                gameGrid[r + 1][c].occupied = OCCUPIED;
-                                gameGrid[r][c].occupied = EMPTY;
-                            }
-                        }
-                    }
-
-                    // Recheck The Current Row After Shifting
-                    row--;
-                }
+            for (unsigned int col = 0; col < Cols; ++col) {
+                clearCell(row, col);
             }
 
-            if (rowCleared)
+        }
+
+
+        /*
+
+            Desc: CoreListener Handler; Remembers The Upcoming Shape And Redraws The
+            Preview Window Once Our Buffers Exist.
+
+            Preconditions:
+                1.) piece Indexes A Valid PIECE_TABLE Entry.
+
+            Postconditions:
+                1.) This->nextPiece & This->nextShapeCell Reflect The Upcoming Shape.
+                2.) If Initialized, This->previewGrid Shows The Upcoming Shape.
+
+        */
+        void onNextPieceChanged(unsigned int piece, Cell cell) override
+        {
+
+            nextPiece = piece;
+            nextShapeCell = cell;
+
+            if (boardVBO)
             {
-                // Add Score Based On Rows Cleared
-                this->score += rowsCleared * CONFIG::POINTS_PER_LINE;
-                this->totalRowsCleared += rowsCleared;
+                updatePreviewDisplay();
+            }
 
-                if (!(this->totalRowsCleared % CONFIG::LINES_PER_LEVEL))
-                {
-                    this->level++;
-                }
+        }
 
-                this->updateText = true;
 
+        /*
+
+            Desc: CoreListener Handler; Adds The Points From Completed Lines To Our
+            Parent Window's Score, Line Count, And Level.
 
+            Preconditions:
+                1.) Score, Level, And Line Count References Are Valid.
+
+            Postconditions:
+                1.) Parent's Score, Lines, And Level Are Updated.
+                2.) Sets Update Text Flag To Refresh UI Display.
+
+        */
+        void onLinesCleared(unsigned int lines, unsigned int points, bool levelUp) override
+        {
+
+            this->score += points;
+            this->totalRowsCleared += lines;
+
+            if (levelUp)
+            {
+                this->level++;
             }
 
+            this->updateText = true;
+
         }
 
 
         /*
 
-            Desc: Destructor For The Board Class That Cleans Up Allocated Memory
-            And OpenGL Resources.
+            Desc: CoreListener Handler; Flags Our Parent Window That The Game Is Over.
+
+            Preconditions:
+                1.) None
+
+            Postconditions:
+                1.) Parent's Game Over Flag Is Set.
+
+        */
+        void onGameOver() override
+        {
+
+            std::cout << "Game Over!" << std::endl;
+            gameOver = true;
+
+        }
+
+
+        /*
+
+            Desc: Destructor For The Board Class That Cleans Up Its OpenGL Resources.
 
             Preconditions:
                 1.) Board Object Is Being Destroyed Or Going Out Of Scope.
 
             Postconditions:
-                1.) Deletes All Dynamically Allocated Grid Arrays.
-                2.) Cleans Up OpenGL Buffer Objects.
-                3.) Prevents Memory Leaks And Resource Cleanup.
+                1.) Cleans Up OpenGL Buffer Objects.
 
         */
         ~Board() 
@@ -1562,24 +1302,6 @@ class Board
                 glDeleteBuffers(1, &boardEBO);
             }
 
-            // Cleanup Game Grid
-            if (gameGrid)
-            {
-                for (unsigned int i = 0; i < rows; ++i) {
-                    delete[] gameGrid[i];
-                }
-                delete[] gameGrid;
-            }
-
-            // Cleanup Preview Grid
-            if (previewGrid)
-            {
-                for (unsigned int i = 0; i < CONFIG::PREVIEW_ROWS; ++i) {
-                    delete[] previewGrid[i];
-                }
-                delete[] previewGrid;
-            }
-
         }
 
 };
\ No newline at end of file
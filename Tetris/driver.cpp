@@ -47,10 +47,12 @@ int main()
 					{
 						gameWindow.setCurrentState(Window::GameState::GAME_OVER);
 						gameWindow.addToScoreboard(gameWindow.getScore());
+						gameWindow.saveRecord();
 						gameWindow.setupGameOverText();
 					}
 
 				}
+				gameWindow.updateHint(); // Show Whatever The Hint Search Has Found So Far
 				break;
 			case Window::GameState::GAME_OVER:
 				break;
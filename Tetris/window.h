@@ -7,8 +7,16 @@
 #include <vector>
 #include <iostream>
 #include <string>
+#include <charconv>
 #include <cstring>
+#include <cstdlib>
+#include <ctime>
 #include "board.h"
+#include "bot.h"
+#include "gamerecord.h"
+#include "hintsearch.h"
+#include "openingbook.h"
+#include <filesystem>
 #include <fstream>
 #include "config.h"
 
@@ -35,7 +43,24 @@ class Window
     private:
 
         // Tetris Game Board
-        Board gameBoard;
+        Board<CONFIG::BOARD_ROWS, CONFIG::BOARD_COLS> gameBoard;
+
+        // Placements For The Start Of A Game, Shared By The Bot & Hints (Declared First So It Outlives Them)
+        OpeningBook book;
+
+        // Built-In Bot, Playing Each Piece In Place Of The Keyboard While autoPlay Is On
+        Bot<CONFIG::BOARD_ROWS, CONFIG::BOARD_COLS> bot;
+        bool autoPlay = false;
+
+        // Every Input Of The Game Being Played, Bot's Included
+        GameRecord record;
+
+        // Background Search Suggesting Where To Put Each Piece While hintMode Is On
+        HintSearch<CONFIG::BOARD_ROWS, CONFIG::BOARD_COLS> hint;
+        bool hintMode = false;
+        unsigned int hintPiece = UINT32_MAX;        // getPiecesLocked() When The Search Was Started (UINT32_MAX If None)
+        Placement shownHint{};
+        bool hasShownHint = false;
 
         // Cached values for change detection
         unsigned int lastScore = UINT32_MAX;
@@ -291,37 +316,48 @@ class Window
                         break;
 
                     case GameState::PLAYING:
-                        // Game Controls
+                    {
+                        // Game Controls, Recorded As They're Played
+                        RecordingGame<Board<CONFIG::BOARD_ROWS, CONFIG::BOARD_COLS>> game(gameBoard, record);
                         switch (key) 
                         {
                             case GLFW_KEY_SPACE:
                                 addScore(CONFIG::SPACE_BAR_POINTS);
                                 break;
                             case GLFW_KEY_LEFT:
-                                gameBoard.shiftActivePiece('L');
-                                gameBoard.ghostPiece();
+                                game.shiftActivePiece('L');
+                                game.ghostPiece();
                                 this->needsRedraw = true;
                                 break;
                             case GLFW_KEY_RIGHT:
-                                gameBoard.shiftActivePiece('R');
-                                gameBoard.ghostPiece();
+                                game.shiftActivePiece('R');
+                                game.ghostPiece();
                                 this->needsRedraw = true;
                                 break;
                             case GLFW_KEY_DOWN:
-                                gameBoard.step();
+                                game.step();
                                 this->needsRedraw = true;
                                 break;
                             case GLFW_KEY_UP:
-                                gameBoard.rotateActivePiece();
-                                gameBoard.ghostPiece();
+                                game.rotateActivePiece();
+                                game.ghostPiece();
 						        this->needsRedraw = true;
                                 break;
                             case GLFW_KEY_ENTER:
-                                gameBoard.shiftActivePiece('D');
+                                game.shiftActivePiece('D');
+                                this->needsRedraw = true;
+                                break;
+                            case GLFW_KEY_B:
+                                autoPlay = !autoPlay;
+                                break;
+                            case GLFW_KEY_H:
+                                hintMode = !hintMode;
+                                if (!hintMode) this->dropHint();
                                 this->needsRedraw = true;
                                 break;
                         }
                         break;
+                    }
 
                     case GameState::GAME_OVER:
                         switch (key) 
@@ -712,6 +748,59 @@ class Window
         }
 
 
+        /*
+
+            Desc: Adds A Null-Terminated String To The Text Buffer, One Character After
+            Another Starting At (x,y), Without Building Any std::string Along The Way.
+
+            Preconditions:
+                1.) text Is A Valid Null-Terminated String.
+                2.) x, y, scale Are Valid As For addCharToText.
+
+            Postconditions:
+                1.) Adds Every Character Of text To The Text Buffers.
+                2.) Returns The x Position Following The Last Character.
+
+        */
+        float addStringToText(const char* text, float x, const float& y, const float& scale)
+        {
+
+            for (; *text; ++text) {
+                addCharToText(*text, x, y, scale);
+                x += CONFIG::CHAR_SPACING;
+            }
+            return x;
+
+        }
+
+
+        /*
+
+            Desc: Adds The Decimal Digits Of value To The Text Buffer Starting At (x,y),
+            Formatting Them Into A Stack Buffer Rather Than A std::to_string Temporary.
+
+            Preconditions:
+                1.) x, y, scale Are Valid As For addCharToText.
+
+            Postconditions:
+                1.) Adds Every Digit Of value To The Text Buffers.
+                2.) Returns The x Position Following The Last Digit.
+
+        */
+        float addNumberToText(const unsigned int& value, float x, const float& y, const float& scale)
+        {
+
+            char digits[16];
+            char* end = std::to_chars(digits, digits + sizeof(digits), value).ptr;
+            for (const char* c = digits; c != end; ++c) {
+                addCharToText(*c, x, y, scale);
+                x += CONFIG::CHAR_SPACING;
+            }
+            return x;
+
+        }
+
+
         /*
 
             Desc: Updates The Current Text Content For The Main Game Loop, Updating
@@ -735,59 +824,17 @@ class Window
             textVertices.clear();
             textIndices.clear();
 
-            float charSpacing = CONFIG::CHAR_SPACING;
-            float currentX, currentY;
+            // Add "Score:" Label And Digits
+            addStringToText("Score:", -0.95f, 0.85f, 1.0f);
+            addNumberToText(score, -0.65f, 0.85f, 1.0f);
 
-            // Add "Score:" Label
-            currentX = -0.95f;
-            currentY = 0.85f;
-            std::string scoreLabel = "Score:";
-            for (char c : scoreLabel) {
-                addCharToText(c, currentX, currentY, 1.0f);
-                currentX += charSpacing;
-            }
-
-            // Add Score Digits
-            currentX = -0.65f;
-            std::string scoreStr = std::to_string(score);
-            for (char c : scoreStr) {
-                addCharToText(c, currentX, currentY, 1.0f);
-                currentX += charSpacing;
-            }
-
-            // Add "Level:" Label
-            currentX = -0.95f;
-            currentY = 0.75f;
-            std::string levelLabel = "Level:";
-            for (char c : levelLabel) {
-                addCharToText(c, currentX, currentY, 1.0f);
-                currentX += charSpacing;
-            }
-
-            // Add Level Digits
-            currentX = -0.65f;
-            std::string levelStr = std::to_string(level);
-            for (char c : levelStr) {
-                addCharToText(c, currentX, currentY, 1.0f);
-                currentX += charSpacing;
-            }
+            // Add "Level:" Label And Digits
+            addStringToText("Level:", -0.95f, 0.75f, 1.0f);
+            addNumberToText(level, -0.65f, 0.75f, 1.0f);
 
-            // Add "Lines:" Label
-            currentX = -0.95f;
-            currentY = 0.65f;
-            std::string linesLabel = "Lines:";
-            for (char c : linesLabel) {
-                addCharToText(c, currentX, currentY, 1.0f);
-                currentX += charSpacing;
-            }
-
-            // Add Lines Digits
-            currentX = -0.65f;
-            std::string linesStr = std::to_string(linesCleared);
-            for (char c : linesStr) {
-                addCharToText(c, currentX, currentY, 1.0f);
-                currentX += charSpacing;
-            }
+            // Add "Lines:" Label And Digits
+            addStringToText("Lines:", -0.95f, 0.65f, 1.0f);
+            addNumberToText(linesCleared, -0.65f, 0.65f, 1.0f);
 
             // Update GPU Buffers
             if (!textVertices.empty()) 
@@ -882,12 +929,25 @@ class Window
             score(0), level(1), linesCleared(0), isInit(false),
             backgroundVAO(0), backgroundVBO(0), backgroundEBO(0),
             textVAO(0), textVBO(0), textEBO(0), fontTextureID(0),
-		    gameBoard(CONFIG::BOARD_ROWS, CONFIG::BOARD_COLS, w, h, this->score, this->textNeedsUpdate, this->linesCleared, this->level, this->gameOverFlag) 
+		    gameBoard(w, h, this->score, this->textNeedsUpdate, this->linesCleared, this->level, this->gameOverFlag) 
         {
 
+            // Seed The Background Color Picks (Pieces Come From gameBoard's Own Seed)
+            std::srand(static_cast<unsigned int>(std::time(nullptr)));
+
             textVertices.reserve(1000);
             textIndices.reserve(1500);
 
+            record.seed = gameBoard.getSeed();
+            record.inputs.reserve(CONFIG::RECORD_RESERVED_INPUTS);
+
+            // The Book Is Optional; Without One Every Piece Is Searched
+            if (book.open(CONFIG::BOOK_FILE, CONFIG::BOARD_ROWS, CONFIG::BOARD_COLS))
+            {
+                bot.setBook(&book);
+                hint.setBook(&book);
+            }
+
         }
 
         unsigned int tickCount = 0;
@@ -906,6 +966,8 @@ class Window
 				1.) Updates The Game Board State By Stepping It One Tick.
 				2.) If Window Is Not Initialized, Will Print An Error Message.
 				3.) gameBoard Will Be Ready For Rendering The Next Frame.
+				4.) If autoPlay Is On, The Bot Has Played The Active Piece Before The Step.
+				5.) The Bot's Inputs And The Step Are Added To this->record.
 
         */
         void update()
@@ -919,12 +981,92 @@ class Window
 
             this->tickCount = 0;
             glBindVertexArray(backgroundVAO);
+
+            // Let The Bot Steer The Falling Piece Into Place; This Step Then Locks It
+            if (autoPlay)
+            {
+                RecordingGame<Board<CONFIG::BOARD_ROWS, CONFIG::BOARD_COLS>> game(gameBoard, record);
+                bot.playPiece(game, gameBoard.getCore());
+            }
     
+            record.inputs.push_back(RECORD_INPUT::GRAVITY);
 		    gameBoard.step();
 		
         }
 
 
+        /*
+
+            Desc: Keeps The Hint In Step With The Game While hintMode Is On. A New
+            Search Starts For Each New Piece, And Whatever The Search Has Found So Far
+            Is Shown As The Ghost; The Search Itself Runs On Its Own Thread, So This
+            Never Waits On It.
+
+            Preconditions:
+                1.) Called Once Per Frame While Playing.
+
+            Postconditions:
+                1.) If hintMode Is Off, Or There's No Active Piece, Nothing Is Searched Or Shown.
+                2.) Otherwise The Ghost Shows The Latest Hint For The Active Piece, And needsRedraw Is Set If It Changed.
+
+        */
+        void updateHint()
+        {
+
+            if (!hintMode) return;
+
+            const GameCore<CONFIG::BOARD_ROWS, CONFIG::BOARD_COLS>& core = gameBoard.getCore();
+            if (!core.isPieceActive() || core.isGameOver())
+            {
+                this->dropHint();
+                return;
+            }
+
+            // A New Piece Needs A New Search (Locking Already Dropped The Old Hint From The Board)
+            if (core.getPiecesLocked() != hintPiece)
+            {
+                hint.start(core.getOccupancy(), core.getActivePiece(), core.getNextPiece(), core.getActiveRotation(), core.getActiveRow(), core.getActiveCol());
+                hintPiece = core.getPiecesLocked();
+                hasShownHint = false;
+            }
+
+            Placement latest;
+            unsigned int stage;
+            if (!hint.getHint(latest, stage)) return;
+
+            if (!hasShownHint || latest.rotation != shownHint.rotation || latest.row != shownHint.row || latest.col != shownHint.col)
+            {
+                gameBoard.setHint(latest.rotation, latest.row, latest.col);
+                shownHint = latest;
+                hasShownHint = true;
+                this->needsRedraw = true;
+            }
+
+        }
+
+
+        /*
+
+            Desc: Stops Any Hint Search And Takes Its Hint Off The Board.
+
+            Preconditions:
+                1.) None
+
+            Postconditions:
+                1.) The Ghost Shows The Landing Position Again; The Next updateHint() Starts A Fresh Search.
+
+        */
+        void dropHint()
+        {
+
+            hint.cancel();
+            gameBoard.clearHint();
+            hintPiece = UINT32_MAX;
+            hasShownHint = false;
+
+        }
+
+
         /*
         
             Desc: Will Utilize The textShader To Render The Text Located In The textVAO, textVBO, textEBO,
@@ -1132,38 +1274,20 @@ class Window
             float currentY = -0.55f;
 
 		    // Add "Game Over" title
-            std::string titleText = "Game Over";
-            for (char c : titleText) {
-                addCharToText(c, currentX, currentY, 1.0f);
-                currentX += CONFIG::CHAR_SPACING;
-            }
+            addStringToText("Game Over", currentX, currentY, 1.0f);
 
 		    // Add "Score: " label
-		    currentX = -0.95f;
 		    currentY -= 0.1f; // Move down for the next line
-		    std::string scoreLabel = "Score: " + std::to_string(this->score);
-            for(char c: scoreLabel) {
-                addCharToText(c, currentX, currentY, 1.0f);
-                currentX += CONFIG::CHAR_SPACING;
-		    }
+		    currentX = addStringToText("Score: ", -0.95f, currentY, 1.0f);
+            addNumberToText(this->score, currentX, currentY, 1.0f);
 
             // Add "Press Enter to Restart" instruction
-            currentX = -0.95f;
             currentY -= 0.1f; // Move down for the next line
-            std::string instructionText = "Press Enter to Restart";
-            for (char c : instructionText) {
-                addCharToText(c, currentX, currentY, 1.0f);
-                currentX += CONFIG::CHAR_SPACING;
-            }
+            addStringToText("Press Enter to Restart", -0.95f, currentY, 1.0f);
 
             // Leaderboard Right Column Of Screen
-		    currentX = 0.15f;
 		    currentY = 0.85f;
-		    std::string leaderboardText = "Leaderboard:";
-            for (char c : leaderboardText) {
-                addCharToText(c, currentX, currentY, 0.65f);
-                currentX += CONFIG::CHAR_SPACING;
-		    }
+		    addStringToText("Leaderboard:", 0.15f, currentY, 0.65f);
 
 		    // Add scores to leaderboard
 		    currentY -= 0.08f; // Move down for the next line
@@ -1174,21 +1298,18 @@ class Window
             {
 
                 std::string line;
-			    int rank = 1;
+			    unsigned int rank = 1;
 
                 while (std::getline(leaderboardFile, line) && rank <= CONFIG::MAX_LEADERBOARD_ENTRIES)
                 {
 
                     if (!line.empty())
                     {
-                        std::string rankText = std::to_string(rank) + ". " + line;
-
 					    currentX = 0.195f; // Reset X position for each rank
 
-                        for (char c : rankText) {
-                            addCharToText(c, currentX, currentY, 0.5f);
-                            currentX += CONFIG::CHAR_SPACING;
-                        }
+                        currentX = addNumberToText(rank, currentX, currentY, 0.5f);
+                        currentX = addStringToText(". ", currentX, currentY, 0.5f);
+                        addStringToText(line.c_str(), currentX, currentY, 0.5f);
                         currentY -= 0.08f; // Move down for the next line
 					    rank++;
                     }
@@ -1236,25 +1357,14 @@ class Window
             textVertices.clear();
             textIndices.clear();
 
-            float charSpacing = 0.045f;
-            float currentX = -0.95f;
             float currentY = -0.85f;
 
             // Add "Tetris" title
-            std::string titleText = "Tetris";
-            for (char c : titleText) {
-                addCharToText(c, currentX, currentY, 1.0f);
-                currentX += charSpacing;
-            }
+            addStringToText("Tetris", -0.95f, currentY, 1.0f);
 
             // Add "Press Enter to Start" instruction
-            currentX = -0.95f;
             currentY -= 0.1f; // Move down for the next line
-            std::string instructionText = "Press Enter to Start";
-            for (char c : instructionText) {
-                addCharToText(c, currentX, currentY, 1.0f);
-                currentX += charSpacing;
-            }
+            addStringToText("Press Enter to Start", -0.95f, currentY, 1.0f);
 
             // Update GPU buffers
             if (!textVertices.empty()) {
@@ -1666,6 +1776,33 @@ class Window
         }
 
 
+        /*
+
+            Desc: Saves The Game Just Played As CONFIG::RECORD_DIRECTORY/<seed>.txt,
+            For tetris_finesse And Anything Else Replaying Games.
+
+            Preconditions:
+                1.) None
+
+            Postconditions:
+                1.) The Record Is Written, Or An Error Is Printed If It Couldn't Be.
+
+        */
+        void saveRecord()
+        {
+
+            std::error_code error;
+            std::filesystem::create_directories(CONFIG::RECORD_DIRECTORY, error);
+
+            const std::string path = std::string(CONFIG::RECORD_DIRECTORY) + "/" + std::to_string(record.seed) + ".txt";
+            if (!saveGameRecord(path, record))
+            {
+                std::cerr << "Failed to write game record " << path << "." << std::endl;
+            }
+
+        }
+
+
         // Getters & Setters
         unsigned int getScore() const { return score; }
         unsigned int getLevel() const { return level; }
@@ -1698,6 +1835,12 @@ class Window
 		    needsRedraw = true;
             tickCount = 0;
 
+            // Start The Board Over With A Fresh Core, Freshly Seeded So The Game Can Be Replayed From Its Record
+            this->gameBoard.reset((static_cast<std::uint64_t>(std::time(nullptr)) << 32) ^ static_cast<std::uint64_t>(std::rand()));
+            record.seed = gameBoard.getSeed();
+            record.inputs.clear();
+            this->dropHint();
+
             // Set To New Random Background
             this->updateBackgroundVertexColorRandom();
 		    this->currentR = 0.0f;
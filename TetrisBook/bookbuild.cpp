@@ -0,0 +1,164 @@
+#include "bot.h"
+#include "openingbook.h"
+#include "workpool.h"
+#include "config.h"
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <cstdlib>
+#include <filesystem>
+#include <iostream>
+#include <map>
+#include <memory>
+#include <numeric>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+
+using BookBot = Bot<CONFIG::BOARD_ROWS, CONFIG::BOARD_COLS>;
+using Bits = BookBot::Bits;
+
+
+/*
+
+	Usage: tetris_book [output] [pieces] [lookahead] [beamWidth] [threads]
+
+	Builds An Opening Book For The First pieces Pieces (Up To A Bag) Of A Game. For
+	Every Order The First Bag Can Be Dealt In, A Bot Search Knowing The Next
+	lookahead Pieces Of That Order (beamWidth Boards Wide) Picks A Placement For
+	Each Piece, Across threads Threads. Orders Reaching The Same Board & Piece Vote
+	On Its Placement, And Every Order Carries On From The Winner, So A Game
+	Following The Book Never Leaves It Early. The Winners Are Written Sorted By Key
+	To output (Default CONFIG::BOOK_FILE), Then Every Order Is Replayed Through The
+	Book As Read Back, Timing The Lookups.
+
+*/
+int main(int argc, char** argv)
+{
+
+	const std::string path = argc > 1 ? argv[1] : CONFIG::BOOK_FILE;
+	unsigned int pieces = argc > 2 ? std::strtoul(argv[2], nullptr, 10) : CONFIG::BOOK_PIECES;
+	unsigned int lookahead = argc > 3 ? std::strtoul(argv[3], nullptr, 10) : CONFIG::BOOK_LOOKAHEAD;
+	unsigned int beamWidth = argc > 4 ? std::strtoul(argv[4], nullptr, 10) : CONFIG::BOOK_BEAM_WIDTH;
+	unsigned int threads = argc > 5 ? std::strtoul(argv[5], nullptr, 10) : std::thread::hardware_concurrency();
+
+	pieces = std::min(std::max(pieces, 1u), PIECE_COUNT);
+	lookahead = std::max(lookahead, 1u);
+
+	// Every Order Of The First Bag
+	std::vector<std::array<unsigned int, PIECE_COUNT>> orders;
+	std::array<unsigned int, PIECE_COUNT> order;
+	std::iota(order.begin(), order.end(), 0u);
+	do {
+		orders.push_back(order);
+	} while (std::next_permutation(order.begin(), order.end()));
+
+	WorkPool pool(threads);
+	std::vector<std::unique_ptr<BookBot>> bots;
+	for (unsigned int i = 0; i < pool.getThreadCount(); ++i) {
+		bots.push_back(std::make_unique<BookBot>(beamWidth, 1));
+	}
+
+	// Each Order's Board So Far, And Where Its Own Search Would Put The Current Piece
+	std::vector<Bits> boards(orders.size());
+	std::vector<BookEntry> moves(orders.size());
+	std::vector<char> placed(orders.size(), 1);
+	std::vector<BookEntry> entries;
+
+	auto start = std::chrono::steady_clock::now();
+
+	// One Piece At A Time, So Every Order Carries On From The Book's Placements And Games Following The Book Stay In It
+	for (unsigned int i = 0; i < pieces; ++i) {
+		pool.parallelFor(static_cast<unsigned int>(orders.size()), [&](unsigned int task, unsigned int worker) {
+			if (!placed[task]) return;
+
+			BookBot& bot = *bots[worker];
+			const unsigned int piece = orders[task][i];
+			const unsigned int known = std::min(lookahead, PIECE_COUNT - i);
+			const int chosen = bot.choose(boards[task], &orders[task][i], known, 0, 0, PIECE_TABLE_FOR<CONFIG::BOARD_COLS>.get(piece, 0).spawnCol);
+			if (chosen < 0)
+			{
+				placed[task] = 0;
+				return;
+			}
+
+			const Placement& placement = bot.getRootGenerator().getPlacement(chosen);
+			moves[task] = { bookKey(boards[task], piece), placement.rotation, placement.row, placement.col, 0, 1 };
+		});
+
+		// Orders Reaching The Same Board & Piece Vote, Tallied In Order So The Book Doesn't Depend On Thread Timing
+		std::unordered_map<std::uint64_t, std::map<std::uint32_t, std::uint32_t>> votes;
+		for (std::size_t task = 0; task < orders.size(); ++task) {
+			if (!placed[task]) continue;
+			const BookEntry& move = moves[task];
+			votes[move.key][std::uint32_t(move.rotation) << 16 | std::uint32_t(move.row) << 8 | move.col]++;
+		}
+
+		std::unordered_map<std::uint64_t, BookEntry> winners;
+		for (const auto& position : votes) {
+			auto best = position.second.begin();
+			for (auto it = position.second.begin(); it != position.second.end(); ++it) {
+				if (it->second > best->second) best = it;
+			}
+			const BookEntry entry{ position.first, static_cast<std::uint8_t>(best->first >> 16), static_cast<std::uint8_t>(best->first >> 8), static_cast<std::uint8_t>(best->first), 0, best->second };
+			winners[position.first] = entry;
+			entries.push_back(entry);
+		}
+
+		for (std::size_t task = 0; task < orders.size(); ++task) {
+			if (!placed[task]) continue;
+			const BookEntry& winner = winners[moves[task].key];
+			applyPlacement(boards[task], orders[task][i], Placement{ winner.rotation, winner.row, winner.col });
+		}
+	}
+
+	double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+	// A Position Can Only Come Up Again With A Different Piece Count, And So A Different Key, But Keep The First Just In Case
+	std::stable_sort(entries.begin(), entries.end(), [](const BookEntry& a, const BookEntry& b) { return a.key < b.key; });
+	entries.erase(std::unique(entries.begin(), entries.end(), [](const BookEntry& a, const BookEntry& b) { return a.key == b.key; }), entries.end());
+
+	const std::filesystem::path parent = std::filesystem::path(path).parent_path();
+	std::error_code error;
+	if (!parent.empty()) std::filesystem::create_directories(parent, error);
+
+	if (!writeOpeningBook(path, CONFIG::BOARD_ROWS, CONFIG::BOARD_COLS, pieces, entries))
+	{
+		std::cerr << "Failed To Write " << path << std::endl;
+		return 1;
+	}
+
+	// Read It Back The Way The Game Does, Looking Up Every Position Played
+	OpeningBook book;
+	if (!book.open(path, CONFIG::BOARD_ROWS, CONFIG::BOARD_COLS))
+	{
+		std::cerr << "Couldn't Open " << path << " After Writing It" << std::endl;
+		return 1;
+	}
+
+	std::uint64_t lookups = 0, found = 0;
+	auto lookupStart = std::chrono::steady_clock::now();
+	for (const auto& dealt : orders) {
+		Bits board{};
+		for (unsigned int i = 0; i < pieces; ++i) {
+			Placement placement;
+			lookups++;
+			if (!book.lookup(bookKey(board, dealt[i]), placement)) break;
+			found++;
+			applyPlacement(board, dealt[i], placement);
+		}
+	}
+	double lookupSeconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - lookupStart).count();
+
+	std::cout << "Bag Orders:     " << orders.size() << " On " << pool.getThreadCount() << " Threads\n";
+	std::cout << "Pieces:         " << pieces << " Each, Looking " << lookahead << " Ahead " << beamWidth << " Boards Wide\n";
+	std::cout << "Positions:      " << book.getEntryCount() << " (" << std::filesystem::file_size(path, error) << " Bytes)\n";
+	std::cout << "Seconds:        " << seconds << "\n";
+	std::cout << "Lookups Found:  " << found << " Of " << lookups << "\n";
+	std::cout << "Lookups/sec:    " << (lookupSeconds > 0.0 ? lookups / lookupSeconds : 0.0) << std::endl;
+
+	return found == lookups ? 0 : 1;
+
+}
@@ -0,0 +1,92 @@
+#include "bot.h"
+#include "gamecore.h"
+#include "piecestream.h"
+#include "config.h"
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <memory>
+#include <vector>
+
+
+/*
+
+	Usage: tetris_bot [pieces] [beamWidth] [threads] [seed] [tableMB] [lookahead]
+
+	Lets The Bot Play Headless Games (Starting Over On Each Game Over) Until It Has
+	Placed pieces Pieces, Searching beamWidth Boards Deep Across threads Threads
+	(Default: Every Core) Sharing A tableMB Transposition Table (0 For None), Then
+	Reports Pieces Per Second, Search Nodes Per Second, And The Table's Hit Rate.
+	Each Search Knows lookahead Pieces (Default: The Active Piece & The Preview);
+	Longer Lookaheads Are Read Ahead From A Copy Of The Game's Piece Stream, And
+	The Table Is Only Made From Bot::TABLE_MIN_LOOKAHEAD Pieces On.
+
+*/
+int main(int argc, char** argv)
+{
+
+	unsigned int pieces = argc > 1 ? std::strtoul(argv[1], nullptr, 10) : 10000;
+	unsigned int beamWidth = argc > 2 ? std::strtoul(argv[2], nullptr, 10) : CONFIG::BOT_BEAM_WIDTH;
+	unsigned int threads = argc > 3 ? std::strtoul(argv[3], nullptr, 10) : std::thread::hardware_concurrency();
+	std::uint64_t seed = argc > 4 ? std::strtoull(argv[4], nullptr, 10) : 1;
+	std::size_t tableMegabytes = argc > 5 ? std::strtoul(argv[5], nullptr, 10) : CONFIG::BOT_TABLE_MB;
+	unsigned int lookahead = argc > 6 ? std::strtoul(argv[6], nullptr, 10) : Bot<CONFIG::BOARD_ROWS, CONFIG::BOARD_COLS>::MAX_LOOKAHEAD;
+	if (lookahead < 1) lookahead = 1;
+
+	// Shallower Searches Never Use The Table, So Don't Map One For Them
+	if (lookahead < Bot<CONFIG::BOARD_ROWS, CONFIG::BOARD_COLS>::TABLE_MIN_LOOKAHEAD) tableMegabytes = 0;
+
+	using Core = GameCore<CONFIG::BOARD_ROWS, CONFIG::BOARD_COLS>;
+	auto core = std::make_unique<Core>(seed);
+	auto bot = std::make_unique<Bot<CONFIG::BOARD_ROWS, CONFIG::BOARD_COLS>>(beamWidth, threads, DEFAULT_WEIGHTS, tableMegabytes);
+
+	// Every Piece Of The Current Game, Dealt From The Same Seed As The Core's Stream
+	PieceStream stream(seed);
+	std::vector<unsigned int> dealt;
+
+	std::uint64_t lines = 0;
+	unsigned int games = 1;
+	auto start = std::chrono::steady_clock::now();
+
+	while (bot->getStats().pieces < pieces) {
+
+		// Spawn, Place, And Lock One Piece
+		core->step();
+		if (core->isGameOver())
+		{
+			lines += core->getLinesCleared();
+			core->reset(seed + games);
+			stream.reseed(seed + games++);
+			dealt.clear();
+			continue;
+		}
+
+		while (dealt.size() < core->getPiecesLocked() + lookahead) {
+			dealt.push_back(stream.deal());
+		}
+		bot->playPiece(*core, *core, &dealt[core->getPiecesLocked()], lookahead);
+		core->step();
+	}
+	lines += core->getLinesCleared();
+
+	double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+	const BotStats& stats = bot->getStats();
+
+	std::cout << "Beam Width:  " << bot->getBeamWidth() << " On " << bot->getThreadCount() << " Threads, " << lookahead << " Pieces Ahead\n";
+	std::cout << "Games:       " << games << "\n";
+	std::cout << "Pieces:      " << stats.pieces << "\n";
+	std::cout << "Lines:       " << lines << "\n";
+	std::cout << "Seconds:     " << seconds << "\n";
+	std::cout << "Pieces/sec:  " << (seconds > 0.0 ? stats.pieces / seconds : 0.0) << "\n";
+	std::cout << "Nodes:       " << stats.nodes << "\n";
+	std::cout << "Nodes/sec:   " << stats.nodesPerSecond() << std::endl;
+
+	if (const TranspositionTable* table = bot->getTable())
+	{
+		std::cout << "Table:       " << table->getSizeBytes() / (1024 * 1024) << " MB" << (table->usesHugePages() ? " On Huge Pages" : "") << "\n";
+		std::cout << "Table Hits:  " << table->getHits() << " / " << table->getProbes() << " (" << 100.0 * table->getHitRate() << "%)" << std::endl;
+	}
+
+	return 0;
+
+}
@@ -0,0 +1,245 @@
+#pragma once
+
+
+#include <chrono>
+#include <cstdint>
+#include <vector>
+#include "gamecore.h"
+#include "workpool.h"
+#include "xoshiro.h"
+#include "config.h"
+
+
+
+/*
+
+    Desc: Totals Of A BatchSimulator Run.
+
+*/
+struct BatchStats
+{
+
+    std::uint64_t games, pieces, lines;
+    double seconds;
+
+    double gamesPerSecond() const { return seconds > 0.0 ? games / seconds : 0.0; }
+    double piecesPerSecond() const { return seconds > 0.0 ? pieces / seconds : 0.0; }
+
+};
+
+
+/*
+
+    Desc: Placement Policy That Turns And Slides Each New Piece By A Random Amount
+    Before Hard Dropping It. Mostly Useful As A Baseline And For Load Testing.
+
+*/
+struct RandomDropPolicy
+{
+
+    template <typename Core>
+    void operator()(Core& core, Xoshiro256& rng) const
+    {
+
+        for (unsigned int turns = rng.nextBelow(ROTATION_COUNT); turns > 0; --turns) {
+            core.rotateActivePiece();
+        }
+
+        char direction = rng.nextBelow(2) ? 'L' : 'R';
+        for (unsigned int shifts = rng.nextBelow(Core::getCols() / 2 + 1); shifts > 0; --shifts) {
+            core.shiftActivePiece(direction);
+        }
+
+        core.shiftActivePiece('D');
+
+    }
+
+};
+
+
+/*
+
+    Desc: Plays Many Independent Headless Games At Once. Every Board Is A GameCore
+    With Its Own Seed And Its Own Policy Generator, Padded Out To Whole Cache Lines
+    So Threads Stepping Neighbouring Boards Never Share A Line. Boards Are Spread
+    Over A Work-Stealing WorkPool, And Since A Board Only Ever Depends On Its Own
+    Seed, A Run's Results Don't Depend On How Many Threads Played It.
+
+*/
+template <unsigned int Rows, unsigned int Cols>
+class BatchSimulator
+{
+
+    public:
+
+        using Core = GameCore<Rows, Cols>;
+
+
+    private:
+
+        struct alignas(CONFIG::CACHE_LINE_BYTES) Lane
+        {
+
+            Core core;
+            Xoshiro256 rng;                 // Drives The Policy And Seeds Each Next Game
+            std::uint64_t games, pieces, lines;
+
+            explicit Lane(std::uint64_t seed)
+                : core(seed), rng(seed ^ 0xD1B54A32D192ED03ull), games(0), pieces(0), lines(0)
+            {
+            }
+
+        };
+
+        std::vector<Lane> lanes;
+        WorkPool pool;
+
+
+        // Tells A Policy Its Game Ended, If It Wants To Know (Has gameOver(const Core&))
+        template <typename Policy>
+        static auto endGame(Policy& policy, const Core& core, int) -> decltype(policy.gameOver(core), void())
+        {
+            policy.gameOver(core);
+        }
+
+        template <typename Policy>
+        static void endGame(Policy&, const Core&, long)
+        {
+        }
+
+
+        /*
+
+            Desc: Plays One Whole Game On lane, Calling policy Once For Every Piece As
+            It Spawns, Then Stepping Until It Locks. The Piece Whose Spawn Ends The Game
+            Is Never Offered To policy, So It Is Called Exactly Once Per Locked Piece.
+
+            Preconditions:
+                1.) lane.core Has Just Been Reset.
+
+            Postconditions:
+                1.) The Game Is Over Or Hit CONFIG::SIM_MAX_PIECES_PER_GAME.
+                2.) lane's Totals Include The Game.
+                3.) policy.gameOver(lane.core) Was Called, If policy Has One.
+
+        */
+        template <typename Policy>
+        static void playGame(Lane& lane, Policy& policy)
+        {
+
+            Core& core = lane.core;
+            while (!core.isGameOver() && core.getPiecesLocked() < CONFIG::SIM_MAX_PIECES_PER_GAME) {
+                bool spawning = !core.isPieceActive();
+                core.step();
+
+                // A Spawn That Tops Out Still Leaves A Piece "Active" On The Cleared Board
+                if (spawning && core.isPieceActive() && !core.isGameOver())
+                {
+                    policy(core, lane.rng);
+                }
+            }
+            endGame(policy, core, 0);
+
+            lane.games++;
+            lane.pieces += core.getPiecesLocked();
+            lane.lines += core.getLinesCleared();
+
+        }
+
+
+    public:
+
+        /*
+
+            Desc: Creates boardCount Boards, Board i Seeded From The i-th Value Of A
+            Generator Seeded With seed, Played By threadCount Threads.
+
+            Preconditions:
+                1.) None
+
+            Postconditions:
+                1.) Every Board Is Fresh And Has Its Own Seed.
+
+        */
+        BatchSimulator(unsigned int boardCount, std::uint64_t seed, unsigned int threadCount = std::thread::hardware_concurrency())
+            : pool(threadCount)
+        {
+
+            Xoshiro256 seeder(seed);
+            lanes.reserve(boardCount);
+            for (unsigned int i = 0; i < boardCount; ++i) {
+                lanes.emplace_back(seeder.next());
+            }
+
+        }
+
+
+        /*
+
+            Desc: Plays gamesPerBoard Games On Every Board, Reseeding Each Board From Its
+            Own Generator Between Games.
+
+            Preconditions:
+                1.) policy Can Be Copied, And Called As policy(Core&, Xoshiro256&) To
+                    Place A Freshly Spawned Active Piece. Each Board Plays Its Own Copy,
+                    Whose gameOver(const Core&) (If Any) Is Called As Each Game Ends.
+
+            Postconditions:
+                1.) Returns The Games, Pieces, And Lines Played By This Run And Its Wall Time.
+
+        */
+        template <typename Policy = RandomDropPolicy>
+        BatchStats run(unsigned int gamesPerBoard, const Policy& policy = Policy())
+        {
+
+            BatchStats before = getTotals();
+            auto start = std::chrono::steady_clock::now();
+
+            pool.parallelFor(static_cast<unsigned int>(lanes.size()), [&](unsigned int board, unsigned int) {
+                Lane& lane = lanes[board];
+                Policy lanePolicy = policy;
+                for (unsigned int game = 0; game < gamesPerBoard; ++game) {
+                    lane.core.reset(lane.rng.next());
+                    playGame(lane, lanePolicy);
+                }
+            });
+
+            std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+            BatchStats after = getTotals();
+
+            return { after.games - before.games, after.pieces - before.pieces, after.lines - before.lines, elapsed.count() };
+
+        }
+
+
+        /*
+
+            Desc: Sums Every Board's Totals Since It Was Created.
+
+            Preconditions:
+                1.) No run Is In Progress.
+
+            Postconditions:
+                1.) Returns The Summed Games, Pieces, And Lines (seconds Is 0).
+
+        */
+        BatchStats getTotals() const
+        {
+
+            BatchStats totals{ 0, 0, 0, 0.0 };
+            for (const Lane& lane : lanes) {
+                totals.games += lane.games;
+                totals.pieces += lane.pieces;
+                totals.lines += lane.lines;
+            }
+            return totals;
+
+        }
+
+
+        // Getters
+        unsigned int getBoardCount() const { return static_cast<unsigned int>(lanes.size()); }
+        unsigned int getThreadCount() const { return pool.getThreadCount(); }
+        const Core& getBoard(unsigned int board) const { return lanes[board].core; }
+
+};
@@ -0,0 +1,222 @@
+#pragma once
+
+
+#include <array>
+#include <cstdint>
+#include <type_traits>
+
+
+
+/*
+
+    Desc: Holds The Occupancy Of A Tetris Grid As One Machine Word Per Row, Where
+    Bit N Of A Row Represents Column N Of That Row. Shapes Are Described As Row Masks
+    Anchored At Column 0 Which Get Shifted Into Place, So Testing A Whole Placement
+    Is A Handful Of AND Operations Instead Of A Cell-By-Cell Scan Of The Grid. Board
+    Dimensions Are Template Parameters So Rows Live Inline And Every Loop Bound Is A
+    Compile-Time Constant; Boards Up To 16 Columns Wide Use 16-Bit Rows.
+
+*/
+template <unsigned int Rows, unsigned int Cols>
+class BitBoard
+{
+
+    public:
+
+        using RowMask = std::conditional_t<(Cols <= 16), std::uint16_t, std::uint32_t>;
+
+        // Tallest Shape (The Vertical I) Spans 4 Rows
+        static constexpr unsigned int MAX_SHAPE_ROWS = 4;
+        static constexpr unsigned int MAX_COLS = 32;
+
+        static_assert(Rows > 0 && Cols > 0, "Board Must Have At Least One Cell");
+        static_assert(Cols <= MAX_COLS, "Board Is Wider Than A Row Mask");
+
+        // Mask With All Cols Bits Set
+        static constexpr RowMask FULL_ROW = static_cast<RowMask>((std::uint64_t(1) << Cols) - 1u);
+
+
+    private:
+
+        std::array<RowMask, Rows> occupancy;
+
+
+    public:
+
+        /*
+
+            Desc: Creates An Empty Bit Board.
+
+            Preconditions:
+                1.) None
+
+            Postconditions:
+                1.) All Rows Rows Are Empty.
+
+        */
+        BitBoard()
+            : occupancy{}
+        {
+        }
+
+
+        /*
+
+            Desc: Tests Whether A Shape Placed With Its Top-Left Corner At (row, col)
+            Would Overlap An Occupied Cell Or Hang Outside Of The Board.
+
+            Preconditions:
+                1.) shapeRows Holds shapeHeight Row Masks Anchored At Column 0 (Shapes Are At Most 4 Wide).
+                2.) shapeHeight Is No Greater Than BitBoard::MAX_SHAPE_ROWS.
+
+            Postconditions:
+                1.) Returns True If Any Filled Cell Of The Shape Is Out Of Bounds Or Occupied.
+                2.) Returns False If The Shape Fits At (row, col).
+
+        */
+        bool collides(const std::uint16_t* shapeRows, unsigned int shapeHeight, int row, int col) const
+        {
+
+            for (unsigned int i = 0; i < shapeHeight; ++i) {
+                std::uint64_t mask = shapeRows[i];
+                if (!mask) continue;
+
+                // Bits Shifted Past Column 0 Mean The Shape Hangs Off The Left Edge
+                if (col < 0)
+                {
+                    if (mask & ((std::uint64_t(1) << -col) - 1u)) return true;
+                    mask >>= -col;
+                }
+                else
+                {
+                    mask <<= col;
+                }
+
+                // Bits Past The Last Column Mean The Shape Hangs Off The Right Edge
+                int targetRow = row + static_cast<int>(i);
+                if ((mask & ~std::uint64_t(FULL_ROW)) || targetRow < 0 || targetRow >= static_cast<int>(Rows)) return true;
+
+                if (mask & occupancy[targetRow]) return true;
+            }
+
+            return false;
+
+        }
+
+
+        /*
+
+            Desc: Marks Every Filled Cell Of A Shape Placed At (row, col) As Occupied.
+
+            Preconditions:
+                1.) The Shape Fits At (row, col) (BitBoard::collides Returned False).
+
+            Postconditions:
+                1.) The Shape's Cells Are Set In The Occupancy Rows.
+
+        */
+        void place(const std::uint16_t* shapeRows, unsigned int shapeHeight, unsigned int row, unsigned int col)
+        {
+
+            for (unsigned int i = 0; i < shapeHeight; ++i) {
+                occupancy[row + i] = static_cast<RowMask>(occupancy[row + i] | (static_cast<RowMask>(shapeRows[i]) << col));
+            }
+
+        }
+
+
+        /*
+
+            Desc: Copies One Row's Occupancy Over Another (Used When Compacting Rows
+            Down Over Cleared Lines).
+
+            Preconditions:
+                1.) fromRow & toRow Are Within The Board.
+
+            Postconditions:
+                1.) toRow Holds What fromRow Holds; fromRow Is Unchanged.
+
+        */
+        void moveRow(unsigned int fromRow, unsigned int toRow)
+        {
+
+            occupancy[toRow] = occupancy[fromRow];
+
+        }
+
+
+        /*
+
+            Desc: Empties A Single Row.
+
+            Preconditions:
+                1.) row Is Within The Board.
+
+            Postconditions:
+                1.) row Is Empty.
+
+        */
+        void clearRow(unsigned int row)
+        {
+
+            occupancy[row] = 0;
+
+        }
+
+
+        /*
+
+            Desc: Removes Every Full Row, Dropping The Rows Above Down Over Them Like
+            GameCore Does When Lines Are Cleared.
+
+            Preconditions:
+                1.) None
+
+            Postconditions:
+                1.) No Row Is Full; Surviving Rows Keep Their Order At The Bottom.
+                2.) Returns How Many Rows Were Cleared.
+
+        */
+        unsigned int clearFullRows()
+        {
+
+            unsigned int target = Rows;
+            for (unsigned int source = Rows; source > 0; --source) {
+                if (occupancy[source - 1] == FULL_ROW) continue;
+                occupancy[--target] = occupancy[source - 1];
+            }
+
+            for (unsigned int row = 0; row < target; ++row) {
+                occupancy[row] = 0;
+            }
+
+            return target;
+
+        }
+
+
+        /*
+
+            Desc: Empties Every Row Of The Board.
+
+            Preconditions:
+                1.) None
+
+            Postconditions:
+                1.) All Rows Are Empty.
+
+        */
+        void clear()
+        {
+
+            occupancy.fill(0);
+
+        }
+
+
+        // Getters
+        RowMask getRow(unsigned int row) const { return occupancy[row]; }
+        bool isRowFull(unsigned int row) const { return occupancy[row] == FULL_ROW; }
+        bool isOccupied(unsigned int row, unsigned int col) const { return (occupancy[row] >> col) & 1u; }
+
+};
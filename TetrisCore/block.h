@@ -0,0 +1,112 @@
+#pragma once
+
+
+#include <array>
+#include <cstdint>
+#include "config.h"
+
+
+
+/*
+
+    Desc: Utilized In The Codebase To Provide State Management Of Our Board,
+    Providing If Its Occupied, Empty, Or Empty But Ghost.
+
+*/
+enum BlockState
+{
+
+    EMPTY = 0, // Empty Cell
+    OCCUPIED = 1, // Cell Occupied By A Piece
+    GHOST = 2 // Ghost Piece
+
+};
+
+
+/*
+
+    Desc: Plain RGB Color Of A Cell, Each Channel In The Range Of [0.0f, 1.0f].
+
+*/
+struct CellColor
+{
+
+    float r, g, b;
+
+};
+
+
+/*
+
+    Desc: Every Color A Cell Can Be Drawn In. Entry 0 Is An Empty Cell, Entry 1 The
+    Ghost Piece, And The Rest Are The Colors Pieces Are Dealt In.
+
+*/
+constexpr unsigned int PALETTE_EMPTY = 0;
+constexpr unsigned int PALETTE_GHOST = 1;
+constexpr unsigned int PALETTE_FIRST_PIECE = 2;
+
+constexpr std::array<CellColor, PALETTE_FIRST_PIECE + CONFIG::COLORS::PIECE_COLOR_COUNT> CELL_PALETTE =
+{{
+
+    { 0.0f, 0.0f, 0.0f },                                                        // Empty
+    { CONFIG::COLORS::GHOST_R, CONFIG::COLORS::GHOST_G, CONFIG::COLORS::GHOST_B }, // Ghost
+    { 0.0f, 0.9f, 0.9f },   // Cyan
+    { 0.95f, 0.85f, 0.0f }, // Yellow
+    { 0.65f, 0.0f, 0.9f },  // Purple
+    { 0.0f, 0.85f, 0.2f },  // Green
+    { 0.95f, 0.1f, 0.1f },  // Red
+    { 1.0f, 0.55f, 0.0f },  // Orange
+    { 0.1f, 0.3f, 1.0f },   // Blue
+    { 1.0f, 0.4f, 0.7f },   // Pink
+    { 0.55f, 0.95f, 0.3f }, // Lime
+    { 0.3f, 0.7f, 1.0f },   // Sky
+    { 0.7f, 0.45f, 0.2f },  // Brown
+    { 0.9f, 0.9f, 0.9f },   // White
+    { 0.0f, 0.55f, 0.55f }, // Teal
+    { 0.6f, 0.2f, 0.35f }   // Maroon
+
+}};
+
+
+/*
+
+    Desc: A Single Cell Packed Into One Byte; The Low 2 Bits Hold Its BlockState And
+    The Upper 6 Bits Its Index Into CELL_PALETTE, So A Whole Board Is One Byte Per Cell
+    And Can Be Copied, Hashed, Or Compared Without Touching Any Vertex Data.
+
+*/
+using Cell = std::uint8_t;
+
+constexpr unsigned int CELL_STATE_BITS = 2;
+constexpr Cell CELL_STATE_MASK = (1u << CELL_STATE_BITS) - 1u;
+constexpr Cell EMPTY_CELL = 0;
+
+static_assert(CELL_PALETTE.size() <= (256u >> CELL_STATE_BITS), "Palette Index Doesn't Fit In A Cell");
+
+constexpr Cell makeCell(BlockState state, unsigned int paletteIndex) { return static_cast<Cell>((paletteIndex << CELL_STATE_BITS) | state); }
+constexpr BlockState cellState(Cell cell) { return static_cast<BlockState>(cell & CELL_STATE_MASK); }
+constexpr unsigned int cellPaletteIndex(Cell cell) { return cell >> CELL_STATE_BITS; }
+constexpr const CellColor& cellColor(Cell cell) { return CELL_PALETTE[cellPaletteIndex(cell)]; }
+
+// The Ghost Piece Always Looks The Same
+constexpr Cell GHOST_CELL = makeCell(GHOST, PALETTE_GHOST);
+
+
+/*
+
+    Desc: Data Structure Utilized To Manage Our Tetris Grid And Its Blocks
+    This->vboOffset Will Help Index And Find Where Data For Specific Blocks
+    Reside In The Shared VBO Instance. This->indexOffset Is Likewise, But
+    For Its Position In The EBO Instance. This->cell Is What The Block Is
+    Currently Drawn As, Its Vertex Colors Being Derived From It.
+
+*/
+struct Block
+{
+
+    unsigned int vboOffset;   // Starting Index In Vertices Array
+    unsigned int indexOffset; // Starting Index In Indices Array
+    Cell cell;
+
+};
@@ -0,0 +1,326 @@
+#pragma once
+
+
+#include <cstdint>
+#include "bitboard.h"
+#include "pieces.h"
+#include "simd.h"
+#include "config.h"
+
+
+
+/*
+
+    Desc: Lanes Independent Boards Stored Structure-Of-Arrays: Row r Of Every Board
+    Sits Side By Side In locked[r], So One SIMD Register Holds The Same Row Of 8 Or 16
+    Boards And The Rules Of GameCore::step (Fall A Row, Or Lock And Clear Lines) Run
+    On All Of Them At Once. Each Board's Active Piece Is Kept As A Second Layer Of Row
+    Masks Shaped Like The Board, So Resting Tests, Falling, And Locking Are Plain Row-
+    Wise AND/OR/Select With No Per-Board Indexing. Spawning Is Per Board And Scalar.
+    Boards Are At Most 16 Columns Wide So Every Row Is One 16-Bit Lane. LaneOps Picks
+    The SIMD Flavour (The Widest Evenly Covering Lanes Unless Asked Otherwise), So
+    Every Flavour Can Be Checked Against Scalar On One Target.
+
+*/
+template <unsigned int Rows, unsigned int Cols, unsigned int Lanes, typename LaneOps = typename SIMD::WidestFor<Lanes>::Type>
+class BoardBatch
+{
+
+    public:
+
+        using LaneMask = std::uint32_t;                       // Bit N Stands For Board N
+        using Ops = LaneOps;
+
+        static_assert(Rows > 0 && Cols >= PIECE_CELLS && Cols <= 16, "Batched Rows Are 16-Bit Lanes");
+        static_assert(Lanes > 0 && Lanes <= 32, "Lane Masks Are 32 Bits");
+        static_assert(Lanes % Ops::WIDTH == 0, "Lanes Must Fill Whole Registers");
+
+        static constexpr std::uint16_t FULL_ROW = static_cast<std::uint16_t>((1u << Cols) - 1u);
+        static constexpr LaneMask ALL_LANES = static_cast<LaneMask>((std::uint64_t(1) << Lanes) - 1u);
+        static constexpr LaneMask CHUNK_LANES = static_cast<LaneMask>((std::uint64_t(1) << Ops::WIDTH) - 1u);
+
+
+    private:
+
+        alignas(32) std::uint16_t locked[Rows][Lanes];   // Locked Cells Of Every Board
+        alignas(32) std::uint16_t piece[Rows][Lanes];    // Active Piece Of Every Board
+        LaneMask activeLanes;                            // Boards Currently Dropping A Piece
+
+        // Scoring, Per Board
+        unsigned int score[Lanes], linesCleared[Lanes], level[Lanes];
+
+
+        /*
+
+            Desc: Spreads A LaneMask Out Into All-Ones / All-Zeros 16-Bit Lanes.
+
+            Preconditions:
+                1.) None
+
+            Postconditions:
+                1.) out[lane] Is 0xFFFF For Every Lane Set In mask, Else 0.
+
+        */
+        static void expandLanes(LaneMask mask, std::uint16_t* out)
+        {
+
+            for (unsigned int lane = 0; lane < Lanes; ++lane) {
+                out[lane] = static_cast<std::uint16_t>(0u - ((mask >> lane) & 1u));
+            }
+
+        }
+
+
+        /*
+
+            Desc: Finds The Lowest Board Set In mask.
+
+            Preconditions:
+                1.) mask Is Not 0.
+
+            Postconditions:
+                1.) Returns The Index Of mask's Lowest Set Bit.
+
+        */
+        static unsigned int lowestLane(LaneMask mask)
+        {
+
+            unsigned int lane = 0;
+            while (!(mask & 1u)) {
+                mask >>= 1;
+                lane++;
+            }
+            return lane;
+
+        }
+
+
+        /*
+
+            Desc: Removes Every Full Row Of Every Board, Dropping The Rows Above Into Place.
+            Each Pass Removes The Lowest Full Row Of Each Board At Once: Walking Up From The
+            Floor, Once A Board Has Passed A Full Row Every Row Takes The One Above It.
+            Passes Repeat Until No Board Has A Full Row Left.
+
+            Preconditions:
+                1.) None
+
+            Postconditions:
+                1.) No Board Has A Full Row.
+                2.) Every Board's Score, Lines, And Level Are Updated Like GameCore's.
+
+        */
+        void clearFullRows()
+        {
+
+            const typename Ops::Reg full = Ops::splat(FULL_ROW);
+            unsigned int cleared[Lanes] = {};
+            LaneMask anyCleared = 0;
+            LaneMask clearedThisPass;
+
+            do {
+                clearedThisPass = 0;
+                for (unsigned int c = 0; c < Lanes; c += Ops::WIDTH) {
+                    typename Ops::Reg passed = Ops::zero();
+                    for (unsigned int r = Rows; r-- > 0;) {
+                        typename Ops::Reg current = Ops::load(&locked[r][c]);
+                        passed = Ops::bitOr(passed, Ops::equal(current, full));
+                        typename Ops::Reg above = r ? Ops::load(&locked[r - 1][c]) : Ops::zero();
+                        Ops::store(&locked[r][c], Ops::select(passed, current, above));
+                    }
+                    clearedThisPass |= Ops::laneBits(passed) << c;
+                }
+
+                for (LaneMask lanes = clearedThisPass; lanes; lanes &= lanes - 1) {
+                    cleared[lowestLane(lanes)]++;
+                }
+                anyCleared |= clearedThisPass;
+            } while (clearedThisPass);
+
+            // Score Each Board Just Like GameCore::checkForPoints
+            for (LaneMask lanes = anyCleared; lanes; lanes &= lanes - 1) {
+                unsigned int lane = lowestLane(lanes);
+                score[lane] += cleared[lane] * CONFIG::POINTS_PER_LINE;
+                linesCleared[lane] += cleared[lane];
+                if (!(linesCleared[lane] % CONFIG::LINES_PER_LEVEL))
+                {
+                    level[lane]++;
+                }
+            }
+
+        }
+
+
+
+    public:
+
+        /*
+
+            Desc: Creates Lanes Empty Boards.
+
+            Preconditions:
+                1.) None
+
+            Postconditions:
+                1.) Every Board Is Empty With No Active Piece And A Fresh Score.
+
+        */
+        BoardBatch()
+            : activeLanes(0)
+        {
+
+            for (unsigned int lane = 0; lane < Lanes; ++lane) {
+                resetLane(lane);
+            }
+
+        }
+
+
+        /*
+
+            Desc: Empties One Board And Its Score.
+
+            Preconditions:
+                1.) lane Is Less Than Lanes.
+
+            Postconditions:
+                1.) The Board Is Empty With No Active Piece, A Score Of 0, And Level 1.
+
+        */
+        void resetLane(unsigned int lane)
+        {
+
+            for (unsigned int r = 0; r < Rows; ++r) {
+                locked[r][lane] = 0;
+                piece[r][lane] = 0;
+            }
+            activeLanes &= ~(LaneMask(1) << lane);
+            score[lane] = 0;
+            linesCleared[lane] = 0;
+            level[lane] = 1;
+
+        }
+
+
+        /*
+
+            Desc: Copies A Board's Locked Cells In From A BitBoard Of The Same Size.
+
+            Preconditions:
+                1.) lane Is Less Than Lanes.
+
+            Postconditions:
+                1.) The Board's Locked Cells Match bits; Its Active Piece Is Untouched.
+
+        */
+        void loadLane(unsigned int lane, const BitBoard<Rows, Cols>& bits)
+        {
+
+            for (unsigned int r = 0; r < Rows; ++r) {
+                locked[r][lane] = static_cast<std::uint16_t>(bits.getRow(r));
+            }
+
+        }
+
+
+        /*
+
+            Desc: Drops A New Active Piece Into One Board At The Top Row, Like
+            GameCore::startNewPiece But At A Chosen Rotation And Column.
+
+            Preconditions:
+                1.) lane Is Less Than Lanes And Has No Active Piece.
+
+            Postconditions:
+                1.) Returns False (Game Over For That Board) If The Piece Doesn't Fit At
+                    (0, col); The Board Is Then Left As It Was.
+                2.) Otherwise The Piece Is The Board's Active Piece And Returns True.
+
+        */
+        bool spawn(unsigned int lane, const PieceRotation& shape, unsigned int col)
+        {
+
+            if (col + shape.width > Cols || shape.height > Rows) return false;
+
+            for (unsigned int i = 0; i < shape.height; ++i) {
+                if (locked[i][lane] & (shape.rows[i] << col)) return false;
+            }
+
+            for (unsigned int i = 0; i < shape.height; ++i) {
+                piece[i][lane] = static_cast<std::uint16_t>(shape.rows[i] << col);
+            }
+            activeLanes |= LaneMask(1) << lane;
+            return true;
+
+        }
+
+
+        /*
+
+            Desc: Advances Every Board With An Active Piece By One Step, Following The Rules
+            Of GameCore::step: Pieces With Room Below Fall One Row, Pieces Resting On The
+            Floor Or A Locked Cell Lock In Place, And Any Rows They Complete Are Cleared.
+
+            Preconditions:
+                1.) None
+
+            Postconditions:
+                1.) Returns The Boards Whose Piece Locked (They Now Need A spawn).
+                2.) Every Other Active Piece Is One Row Lower.
+
+        */
+        LaneMask step()
+        {
+
+            if (!activeLanes) return 0;
+
+            // A Piece Rests If It Touches The Floor Or Sits Right On Top Of A Locked Cell
+            LaneMask resting = 0;
+            for (unsigned int c = 0; c < Lanes; c += Ops::WIDTH) {
+                typename Ops::Reg touching = Ops::load(&piece[Rows - 1][c]);
+                for (unsigned int r = 0; r + 1 < Rows; ++r) {
+                    touching = Ops::bitOr(touching, Ops::bitAnd(Ops::load(&piece[r][c]), Ops::load(&locked[r + 1][c])));
+                }
+                resting |= (~Ops::laneBits(Ops::equal(touching, Ops::zero())) & CHUNK_LANES) << c;
+            }
+
+            LaneMask landing = resting & activeLanes;
+            LaneMask falling = ~resting & activeLanes;
+
+            alignas(32) std::uint16_t landMask[Lanes];
+            alignas(32) std::uint16_t fallMask[Lanes];
+            expandLanes(landing, landMask);
+            expandLanes(falling, fallMask);
+
+            // Lock Landing Pieces Into Their Boards And Move Falling Ones Down A Row
+            for (unsigned int c = 0; c < Lanes; c += Ops::WIDTH) {
+                typename Ops::Reg land = Ops::load(&landMask[c]);
+                typename Ops::Reg fall = Ops::load(&fallMask[c]);
+                for (unsigned int r = Rows; r-- > 0;) {
+                    typename Ops::Reg current = Ops::load(&piece[r][c]);
+                    typename Ops::Reg above = r ? Ops::load(&piece[r - 1][c]) : Ops::zero();
+                    Ops::store(&locked[r][c], Ops::bitOr(Ops::load(&locked[r][c]), Ops::bitAnd(current, land)));
+                    Ops::store(&piece[r][c], Ops::select(fall, Ops::andNot(land, current), above));
+                }
+            }
+
+            activeLanes &= ~landing;
+            if (landing)
+            {
+                clearFullRows();
+            }
+
+            return landing;
+
+        }
+
+
+        // Getters
+        LaneMask getActiveLanes() const { return activeLanes; }
+        std::uint16_t getRow(unsigned int lane, unsigned int row) const { return locked[row][lane]; }
+        std::uint16_t getPieceRow(unsigned int lane, unsigned int row) const { return piece[row][lane]; }
+        unsigned int getScore(unsigned int lane) const { return score[lane]; }
+        unsigned int getLinesCleared(unsigned int lane) const { return linesCleared[lane]; }
+        unsigned int getLevel(unsigned int lane) const { return level[lane]; }
+
+};
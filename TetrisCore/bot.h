@@ -0,0 +1,511 @@
+#pragma once
+
+
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <cstdint>
+#include <limits>
+#include <memory>
+#include <vector>
+#include "evaluator.h"
+#include "gamecore.h"
+#include "movegen.h"
+#include "openingbook.h"
+#include "transtable.h"
+#include "zobrist.h"
+#include "workpool.h"
+#include "config.h"
+
+
+
+/*
+
+    Desc: Running Totals Of What A Bot Has Played And Searched.
+
+*/
+struct BotStats
+{
+
+    std::uint64_t pieces, nodes;
+    std::uint64_t bookMoves;        // Pieces Played Straight From The Opening Book
+    double searchSeconds;
+
+    double nodesPerSecond() const { return searchSeconds > 0.0 ? nodes / searchSeconds : 0.0; }
+
+};
+
+
+/*
+
+    Desc: Plays Tetris By Itself. For Each Piece It Runs A Beam Search Over The Active
+    Piece And The Preview: Every Placement Of The Active Piece Is Scored With The
+    Feature Evaluator, The Best beamWidth Boards Are Expanded With The Next Piece
+    Across A WorkPool (One MoveGenerator Per Worker), And So On, And The Active
+    Piece's Placement Leading To The Best Final Board Is Played Through The Same
+    Inputs The Keyboard Sends. The Last Piece Only Needs Each Board's Best Child.
+    Searches Looking At Least TABLE_MIN_LOOKAHEAD Pieces Ahead, Deep Enough For
+    Different Placements To Reach The Same Board, Can Share A TranspositionTable:
+    Beam Boards Already Being Expanded With The Same Pieces Left Are Dropped, And
+    Each Board's Best Last-Piece Child Is Only Found Once, Even Across Searches.
+    Positions Found In An Opening Book, If One Is Set, Are Played From It Without
+    Searching. Every Buffer Is Sized Up Front So Searching Never Touches The Heap.
+
+*/
+template <unsigned int Rows, unsigned int Cols>
+class Bot
+{
+
+    public:
+
+        using Core = GameCore<Rows, Cols>;
+        using Bits = BitBoard<Rows, Cols>;
+        using Generator = MoveGenerator<Rows, Cols>;
+
+        // Active Piece Plus The One Preview Piece GameCore Shows
+        static constexpr unsigned int MAX_LOOKAHEAD = 2;
+
+        // Fewest Pieces A Search Needs Before Boards Repeat Often Enough To Be Worth Tabling
+        static constexpr unsigned int TABLE_MIN_LOOKAHEAD = 3;
+
+
+    private:
+
+        struct Node
+        {
+
+            Bits board;
+            std::uint64_t hash;     // Zobrist Hash Of board (Only Kept While The Table Is In Use)
+            float score;
+            unsigned int lines;     // Lines Cleared Since The Root
+            unsigned int root;      // Which Root Placement This Board Came From
+
+        };
+
+        WorkPool pool;
+        EvalWeights weights;
+        unsigned int beamWidth;
+
+        // Root Placements Stay In Their Own Generator So Their Paths Survive The Search
+        Generator rootGenerator;
+        std::vector<Generator> generators;      // One Per Worker
+
+        // Boards Being Expanded, And Every Child Of Them (Generator::STATE_COUNT Slots Per Board)
+        std::vector<Node> beam, children;
+        std::vector<unsigned int> childCounts;
+        std::vector<float> leafScores;          // Best Child Of Each Beam Board On The Last Piece
+        unsigned int expandingPiece;
+        unsigned int piecesLeft;                // Pieces Still To Place Below The Beam, expandingPiece Included
+
+        // Boards Already Expanded, Keyed By Board & Piece (Null When Turned Off)
+        std::unique_ptr<TranspositionTable> table;
+        bool tableActive;                       // Whether The Current Search Is Deep Enough To Use It
+
+        // Placements Looked Up Instead Of Searched (Null When There's No Book)
+        const OpeningBook* book;
+
+        std::array<char, Generator::MAX_PATH_LENGTH> path;
+        BotStats stats;
+
+
+        static bool better(const Node& a, const Node& b)
+        {
+            return a.score > b.score;
+        }
+
+
+        /*
+
+            Desc: Hashes A Child Board From Its Parent's Hash. Only The Placed Piece's
+            Cells Need Keying In, Unless Lines Were Cleared, Which Shifts Rows And Takes
+            A Full Rehash.
+
+            Preconditions:
+                1.) child Is The Parent Board With piece Locked At placement, Clearing lines Lines.
+
+            Postconditions:
+                1.) Returns hashBoard(child).
+
+        */
+        static std::uint64_t childHash(std::uint64_t parentHash, const Bits& child, unsigned int piece, const Placement& placement, unsigned int lines)
+        {
+
+            if (lines) return hashBoard(child);
+
+            const PieceRotation& shape = PIECE_TABLE_FOR<Cols>.get(piece, placement.rotation);
+            std::uint64_t hash = parentHash;
+            for (unsigned int cell = 0; cell < PIECE_CELLS; ++cell) {
+                hash ^= ZOBRIST_KEYS<Rows, Cols>.cells[(placement.row + shape.cellRow[cell]) * Cols + placement.col + shape.cellCol[cell]];
+            }
+            return hash;
+
+        }
+
+
+        /*
+
+            Desc: Keys A Board Waiting For this->expandingPiece With this->piecesLeft
+            Pieces To Go. Each Depth Gets Keys Of Its Own, So Entries Stored At One
+            Depth Never Turn Up (Or Count As Hits) When Probing Another.
+
+            Preconditions:
+                1.) boardHash Is hashBoard() Of The Board.
+
+            Postconditions:
+                1.) Returns The Board's Key In this->table.
+
+        */
+        std::uint64_t tableKey(std::uint64_t boardHash) const
+        {
+
+            return boardHash ^ ZOBRIST_KEYS<Rows, Cols>.pieces[expandingPiece] ^ (piecesLeft * 0x9E3779B97F4A7C15ull);
+
+        }
+
+
+        /*
+
+            Desc: Drops Beam Boards Already Kept Earlier In This Search With The Same
+            Piece To Place And Pieces Left (Transpositions), Since Their Children Would
+            Only Repeat Those Of The Copy Kept. Kept Boards Are Marked In this->table At
+            Their Real Depth, So These Marks Win Its Depth-Preferred Slots Over The
+            Last Piece's Single-Depth Entries.
+
+            Preconditions:
+                1.) this->tableActive; this->expandingPiece & this->piecesLeft Are Set.
+
+            Postconditions:
+                1.) beam[0, Returned Count) Holds The First Copy Of Each Board, In Order.
+
+        */
+        unsigned int dropTranspositions(unsigned int beamSize)
+        {
+
+            unsigned int kept = 0;
+            for (unsigned int i = 0; i < beamSize; ++i) {
+                const std::uint64_t key = tableKey(beam[i].hash);
+                TableHit hit;
+                if (table->probe(key, hit) && hit.current) continue;
+
+                table->store(key, beam[i].score, Placement{}, piecesLeft);
+                if (kept != i) beam[kept] = beam[i];
+                kept++;
+            }
+            return kept;
+
+        }
+
+
+        /*
+
+            Desc: Places Every Reachable Placement Of this->expandingPiece On One Beam
+            Board, Scoring Each Child Into That Board's Slots Of this->children.
+
+            Preconditions:
+                1.) index Is Within this->beam; worker Is The WorkPool Worker Running It.
+
+            Postconditions:
+                1.) this->childCounts[index] Children Are Scored In Slot index.
+
+        */
+        void expand(unsigned int index, unsigned int worker)
+        {
+
+            const Node& parent = beam[index];
+            Generator& generator = generators[worker];
+            const unsigned int placements = generator.generate(parent.board, expandingPiece);
+
+            Node* slot = &children[index * Generator::STATE_COUNT];
+            for (unsigned int i = 0; i < placements; ++i) {
+                Node& child = slot[i];
+                child.board = parent.board;
+                const unsigned int lines = applyPlacement(child.board, expandingPiece, generator.getPlacement(i));
+                child.lines = parent.lines + lines;
+                child.score = evaluateBoard(child.board, child.lines, weights);
+                if (tableActive) child.hash = childHash(parent.hash, child.board, expandingPiece, generator.getPlacement(i), lines);
+                child.root = parent.root;
+            }
+            childCounts[index] = placements;
+
+        }
+
+
+        /*
+
+            Desc: Finds The Best Child Of One Beam Board On The Last Piece Searched,
+            Looking It Up In this->table First And Storing It There After (When The
+            Search Uses The Table). Best Children Don't Depend On The Search, So Entries
+            Of Earlier Searches Are Used As Well. Lines Only Count Linearly, So The Child
+            Is Scored On Its Own Lines And The Parent's Are Added After, Letting Boards
+            Reached With Different Line Counts Share An Entry.
+
+            Preconditions:
+                1.) index Is Within this->beam; worker Is The WorkPool Worker Running It.
+
+            Postconditions:
+                1.) this->leafScores[index] Holds The Best Child's Score (Lowest Float If There's None).
+                2.) this->childCounts[index] Is How Many Children Were Scored (0 On A Table Hit).
+
+        */
+        void expandLeaf(unsigned int index, unsigned int worker)
+        {
+
+            const Node& parent = beam[index];
+            const float parentLines = weights[LINES_CLEARED] * parent.lines;
+            childCounts[index] = 0;
+
+            const std::uint64_t key = tableActive ? tableKey(parent.hash) : 0;
+            TableHit hit;
+            if (tableActive && table->probe(key, hit))
+            {
+                leafScores[index] = hit.score + parentLines;
+                return;
+            }
+
+            Generator& generator = generators[worker];
+            const unsigned int placements = generator.generate(parent.board, expandingPiece);
+
+            float best = std::numeric_limits<float>::lowest();
+            unsigned int bestIndex = 0;
+            for (unsigned int i = 0; i < placements; ++i) {
+                Bits child = parent.board;
+                const unsigned int lines = applyPlacement(child, expandingPiece, generator.getPlacement(i));
+                const float score = evaluateBoard(child, lines, weights);
+                if (score > best)
+                {
+                    best = score;
+                    bestIndex = i;
+                }
+            }
+
+            if (placements && tableActive) table->store(key, best, generator.getPlacement(bestIndex), piecesLeft);
+            leafScores[index] = placements ? best + parentLines : best;
+            childCounts[index] = placements;
+
+        }
+
+
+    public:
+
+        /*
+
+            Desc: Creates A Bot Searching newBeamWidth Boards Deep Across threads Threads,
+            Sharing A tableMegabytes Transposition Table Between Them. The Table Only
+            Pays Off For Searches Of At Least TABLE_MIN_LOOKAHEAD Pieces, So There's
+            None Unless Asked For.
+
+            Preconditions:
+                1.) newBeamWidth Is At Least 1.
+
+            Postconditions:
+                1.) Every Search Buffer Is Allocated And The WorkPool Is Started.
+                2.) There's No Table If tableMegabytes Is 0.
+
+        */
+        explicit Bot(unsigned int newBeamWidth = CONFIG::BOT_BEAM_WIDTH, unsigned int threads = std::thread::hardware_concurrency(), const EvalWeights& newWeights = DEFAULT_WEIGHTS, std::size_t tableMegabytes = 0)
+            : pool(threads), weights(newWeights), beamWidth(newBeamWidth ? newBeamWidth : 1),
+            generators(pool.getThreadCount()),
+            beam(beamWidth * Generator::STATE_COUNT), children(beamWidth * Generator::STATE_COUNT), childCounts(beamWidth), leafScores(beamWidth),
+            expandingPiece(0), piecesLeft(0), table(tableMegabytes ? std::make_unique<TranspositionTable>(tableMegabytes) : nullptr), tableActive(false),
+            book(nullptr), path{}, stats{}
+        {
+        }
+
+
+        /*
+
+            Desc: Finds The Best Placement For pieces[0] Starting From (rotation, row, col),
+            Looking Ahead Through The Rest Of pieces.
+
+            Preconditions:
+                1.) pieceCount Is At Least 1 (A Game Only Shows MAX_LOOKAHEAD, But Searches Knowing More Can Look Further).
+
+            Postconditions:
+                1.) Returns The Index Of The Chosen Placement In getRootGenerator(), Or -1 If The Piece Can't Be Placed.
+                2.) The Boards Searched Are Added To The Stats.
+                3.) The Table Is Only Used If pieceCount Is At Least TABLE_MIN_LOOKAHEAD.
+
+        */
+        int choose(const Bits& board, const unsigned int* pieces, unsigned int pieceCount, unsigned int rotation, unsigned int row, unsigned int col)
+        {
+
+            auto start = std::chrono::steady_clock::now();
+
+            tableActive = table && pieceCount >= TABLE_MIN_LOOKAHEAD;
+            const std::uint64_t rootHash = tableActive ? hashBoard(board) : 0;
+
+            // Score Every Placement Of The Active Piece
+            const unsigned int rootCount = rootGenerator.generate(board, pieces[0], rotation, row, col);
+            for (unsigned int i = 0; i < rootCount; ++i) {
+                Node& node = beam[i];
+                node.board = board;
+                node.lines = applyPlacement(node.board, pieces[0], rootGenerator.getPlacement(i));
+                node.score = evaluateBoard(node.board, node.lines, weights);
+                node.root = i;
+                if (tableActive) node.hash = childHash(rootHash, node.board, pieces[0], rootGenerator.getPlacement(i), node.lines);
+            }
+            stats.nodes += rootCount;
+
+            if (tableActive) table->newSearch();
+
+            unsigned int beamSize = rootCount;
+            for (unsigned int depth = 1; depth < pieceCount && beamSize > 0; ++depth) {
+
+                // Keep The Best Boards, Then Expand Them All At Once
+                if (beamSize > beamWidth)
+                {
+                    std::partial_sort(beam.begin(), beam.begin() + beamWidth, beam.begin() + beamSize, better);
+                    beamSize = beamWidth;
+                }
+
+                expandingPiece = pieces[depth];
+                piecesLeft = pieceCount - depth;
+
+                // On The Last Piece Only The Best Child Of Each Board Matters
+                if (depth + 1 == pieceCount)
+                {
+                    pool.parallelFor(beamSize, [this](unsigned int task, unsigned int worker) { expandLeaf(task, worker); });
+
+                    unsigned int bestLeaf = 0;
+                    for (unsigned int i = 0; i < beamSize; ++i) {
+                        stats.nodes += childCounts[i];
+                        if (leafScores[i] > leafScores[bestLeaf]) bestLeaf = i;
+                    }
+
+                    // Unless Every Looked-Ahead Board Topped Out, Which Leaves The Active Piece Alone To Judge By
+                    if (leafScores[bestLeaf] > std::numeric_limits<float>::lowest())
+                    {
+                        stats.searchSeconds += std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+                        return static_cast<int>(beam[bestLeaf].root);
+                    }
+                    break;
+                }
+
+                if (tableActive) beamSize = dropTranspositions(beamSize);
+                pool.parallelFor(beamSize, [this](unsigned int task, unsigned int worker) { expand(task, worker); });
+
+                // Gather The Children As The Next Beam
+                unsigned int next = 0;
+                for (unsigned int i = 0; i < beamSize; ++i) {
+                    const Node* slot = &children[i * Generator::STATE_COUNT];
+                    for (unsigned int j = 0; j < childCounts[i]; ++j) {
+                        beam[next++] = slot[j];
+                    }
+                    stats.nodes += childCounts[i];
+                }
+
+                // Every Looked-Ahead Board Topped Out, So Judge By The Active Piece Alone
+                if (next == 0) break;
+                beamSize = next;
+            }
+
+            stats.searchSeconds += std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+            if (beamSize == 0) return -1;
+            return static_cast<int>(std::min_element(beam.begin(), beam.begin() + beamSize, better)->root);
+
+        }
+
+
+        /*
+
+            Desc: Plays The Active Piece Of core Through game's Input Functions (game Is
+            Either core Itself Or Something Forwarding To It, Like Our Board), Leaving
+            It Resting Where The Opening Book Or The Search Chose; The Next Step Locks It.
+
+            Preconditions:
+                1.) game Forwards Its Inputs To core.
+
+            Postconditions:
+                1.) Returns False, Playing Nothing, If core Has No Active Piece Or It Can't Be Placed.
+                2.) Otherwise The Chosen Path Was Played And Returns True.
+
+        */
+        template <typename Game>
+        bool playPiece(Game& game, const Core& core)
+        {
+
+            if (!core.isPieceActive()) return false;
+
+            const unsigned int pieces[MAX_LOOKAHEAD] = { core.getActivePiece(), core.getNextPiece() };
+            return playPiece(game, core, pieces, MAX_LOOKAHEAD);
+
+        }
+
+
+        /*
+
+            Desc: Plays The Active Piece Like playPiece(game, core), But Searching Through
+            pieces (Known Some Other Way, Like From A Copy Of The Game's Piece Stream)
+            Instead Of Just The Preview core Shows.
+
+            Preconditions:
+                1.) game Forwards Its Inputs To core.
+                2.) pieceCount Is At Least 1, And pieces[0] Is core's Active Piece.
+
+            Postconditions:
+                1.) Same As playPiece(game, core).
+
+        */
+        template <typename Game>
+        bool playPiece(Game& game, const Core& core, const unsigned int* pieces, unsigned int pieceCount)
+        {
+
+            if (!core.isPieceActive() || core.isGameOver()) return false;
+
+            // Early Positions Come Straight From The Book When It Has Them
+            int chosen = -1;
+            if (book)
+            {
+                rootGenerator.generate(core.getOccupancy(), core.getActivePiece(), core.getActiveRotation(), core.getActiveRow(), core.getActiveCol());
+                chosen = book->find(core.getOccupancy(), core.getActivePiece(), rootGenerator);
+                if (chosen >= 0) stats.bookMoves++;
+            }
+
+            if (chosen < 0)
+            {
+                chosen = choose(core.getOccupancy(), pieces, pieceCount, core.getActiveRotation(), core.getActiveRow(), core.getActiveCol());
+            }
+            if (chosen < 0) return false;
+
+            const unsigned int length = rootGenerator.getPath(rootGenerator.getPlacement(chosen), path.data());
+            playPath(game, path.data(), length);
+            stats.pieces++;
+            return true;
+
+        }
+
+
+        /*
+
+            Desc: Swaps In New Evaluation Weights For Following Searches.
+
+            Preconditions:
+                1.) No Search Is Running.
+
+            Postconditions:
+                1.) this->weights Is newWeights; The Table, Scored Under The Old Weights, Is Emptied.
+
+        */
+        void setWeights(const EvalWeights& newWeights)
+        {
+
+            weights = newWeights;
+            if (table) table->clear();
+
+        }
+
+
+        // Consults newBook (Which Must Outlive The Bot, Or Be Swapped Out First) Before Searching; Null Turns It Off
+        void setBook(const OpeningBook* newBook) { book = newBook; }
+
+
+        // Getters
+        const EvalWeights& getWeights() const { return weights; }
+        const BotStats& getStats() const { return stats; }
+        const TranspositionTable* getTable() const { return table.get(); }
+        const Generator& getRootGenerator() const { return rootGenerator; }
+        unsigned int getBeamWidth() const { return beamWidth; }
+        unsigned int getThreadCount() const { return pool.getThreadCount(); }
+
+};
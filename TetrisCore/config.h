@@ -0,0 +1,269 @@
+#pragma once
+
+
+namespace CONFIG
+{
+
+
+    // ==============================================
+    // GAME TIMING & PERFORMANCE SETTINGS
+    // ==============================================
+
+    // Base Game Speed (Lower = Faster)
+    constexpr unsigned int BASE_DROP_SPEED = 13;
+
+    // Frame Rate Settings
+    constexpr double TARGET_FPS = 45.0;
+    constexpr double FRAME_TIME_MS = 1000.0 / TARGET_FPS;
+
+
+
+    // ==============================================
+    // WINDOW & DISPLAY SETTINGS
+    // ==============================================
+
+    // Window Dimensions
+    constexpr unsigned int WINDOW_WIDTH = 1200;
+    constexpr unsigned int WINDOW_HEIGHT = 1200;
+    constexpr const char* WINDOW_TITLE = "Tetris";
+
+    // Game Board Dimensions
+    constexpr unsigned int BOARD_ROWS = 20;
+    constexpr unsigned int BOARD_COLS = 10;
+
+    // Alternate Board Dimensions (Each Is Its Own GameCore Instantiation)
+    constexpr unsigned int TALL_BOARD_ROWS = 40;    // Tall Buffer For Simulations
+    constexpr unsigned int WIDE_BOARD_COLS = 20;    // Wide Mode
+
+    // Preview Board Dimensions
+    constexpr unsigned int PREVIEW_ROWS = 4;
+    constexpr unsigned int PREVIEW_COLS = 4;
+
+
+
+    // ==============================================
+    // TETRIS GAME MECHANICS
+    // ==============================================
+
+    // Difficulty Progression
+    constexpr unsigned int MAX_LEVEL = 10;
+    constexpr unsigned int LINES_PER_LEVEL = 5;
+    constexpr float SPEED_CURVE_FACTOR = 11.0f;
+
+    // Scoring System
+    constexpr unsigned int POINTS_PER_LINE = 100;
+    constexpr unsigned int SPACE_BAR_POINTS = 100;
+
+    // Ghost Piece Settings
+    constexpr unsigned int MIN_GHOST_DISTANCE = 4;
+
+
+
+    // ==============================================
+    // UI & RENDERING SETTINGS
+    // ==============================================
+
+    // Text Rendering
+    constexpr float CHAR_SPACING = 0.045f;
+    constexpr unsigned int FONT_ATLAS_SIZE = 128;
+    constexpr float CHAR_PIXEL_SIZE = 8.0f;
+    constexpr float CHAR_SIZE = 1.0f / 16.0f;
+
+    // Cell Uploads (Batched Per Frame)
+    constexpr unsigned int MAX_UPLOAD_GAP_CELLS = 16;  // Clean Cells Worth Re-Uploading To Merge Two Runs
+    constexpr unsigned int DIRTY_CELLS_PER_CELL = 4;   // Queued Changes Reserved Per Cell Before Uploading All
+
+    // Background Colors (RGB values 0.0-1.0)
+    namespace COLORS
+    {
+        constexpr float BACKGROUND_TRANSITION_SPEED = 0.01f;
+        constexpr int COLOR_CHANGE_TIMER_MIN = 5;
+        constexpr int COLOR_CHANGE_TIMER_MAX = 10;
+
+        // Grid Colors
+        constexpr float GRID_R = 0.3f;
+        constexpr float GRID_G = 0.3f;
+        constexpr float GRID_B = 0.3f;
+
+        // Ghost Piece Color
+        constexpr float GHOST_R = 0.5f;
+        constexpr float GHOST_G = 0.5f;
+        constexpr float GHOST_B = 0.5f;
+
+        // Piece Colors (Each Piece Is Dealt One At Random From CELL_PALETTE)
+        constexpr unsigned int PIECE_COLOR_COUNT = 14;
+
+        // Clear/Background Color
+        constexpr float CLEAR_R = 0.1f;
+        constexpr float CLEAR_G = 0.1f;
+        constexpr float CLEAR_B = 0.1f;
+    }
+
+
+    // Leaderboard Settings
+    constexpr unsigned int MAX_LEADERBOARD_ENTRIES = 10;
+    constexpr const char* LEADERBOARD_FILE = "leaderboard.txt";
+
+    // Game Records (Seed & Every Input), One File Per Game, Kept For Replays & Finesse Analysis
+    constexpr const char* RECORD_DIRECTORY = "records";
+    constexpr unsigned int RECORD_RESERVED_INPUTS = 1u << 20;   // Reserved Up Front So Hours Of Play Record Without Allocating
+
+
+
+    // ==============================================
+    // HEADLESS SIMULATION SETTINGS
+    // ==============================================
+
+    // Per-Thread & Per-Board Data Is Padded Out To Its Own Cache Line
+    constexpr unsigned int CACHE_LINE_BYTES = 64;
+
+    // Games Still Going After This Many Pieces Are Cut Short
+    constexpr unsigned int SIM_MAX_PIECES_PER_GAME = 100000;
+
+
+
+    // ==============================================
+    // BOT SETTINGS
+    // ==============================================
+
+    // Boards Kept At Each Depth Of The Bot's Beam Search
+    constexpr unsigned int BOT_BEAM_WIDTH = 32;
+
+    // Transposition Table tetris_bot Shares Between Search Threads, In Megabytes (0 Turns It Off);
+    // Only Searches Of At Least Bot::TABLE_MIN_LOOKAHEAD Pieces Use It, So Other Bots Go Without
+    constexpr unsigned int BOT_TABLE_MB = 16;
+
+    // How Much Each Board Feature Is Worth To The Bot (Higher Is Better)
+    namespace BOT_WEIGHTS
+    {
+        constexpr float HOLES = -0.36f;
+        constexpr float AGGREGATE_HEIGHT = -0.51f;
+        constexpr float BUMPINESS = -0.18f;
+        constexpr float WELLS = -0.10f;
+        constexpr float LINES_CLEARED = 0.76f;
+    }
+
+
+
+    // ==============================================
+    // WEIGHT TUNER SETTINGS
+    // ==============================================
+
+    // Candidate Weight Vectors Evolved Per Generation, And How Many Survive Into The Next
+    constexpr unsigned int TUNE_POPULATION = 24;
+    constexpr unsigned int TUNE_SURVIVORS = 8;
+
+    // Seeded Games Each Candidate Plays Per Generation (Every Candidate Gets The Same Seeds),
+    // Searched With BOT_BEAM_WIDTH Like The Interactive Bot So The Weights Carry Over
+    constexpr unsigned int TUNE_GAMES_PER_CANDIDATE = 8;
+    constexpr unsigned int TUNE_MAX_PIECES = 1000;
+
+    // Chance Each Weight Of A Child Is Nudged, And How Far
+    constexpr float TUNE_MUTATION_RATE = 0.3f;
+    constexpr float TUNE_MUTATION_SIZE = 0.2f;
+
+    constexpr const char* TUNE_CHECKPOINT_FILE = "tune_checkpoint.txt";
+
+
+
+    // ==============================================
+    // ROLLOUT EVALUATOR SETTINGS
+    // ==============================================
+
+    // Continuations Played From Each Candidate Placement, And How Many Pieces Each Runs
+    constexpr unsigned int ROLLOUT_COUNT = 32;
+    constexpr unsigned int ROLLOUT_DEPTH = 8;
+
+    // Outcome Of A Continuation That Tops Out (Below Any Board The Evaluator Can Score)
+    constexpr float ROLLOUT_TOP_OUT_SCORE = -1000.0f;
+
+
+
+    // ==============================================
+    // PERFECT CLEAR SOLVER SETTINGS
+    // ==============================================
+
+    // Tallest Stack (From The Floor) A Perfect Clear Is Looked For In, And Longest Piece Queue
+    constexpr unsigned int PC_MAX_HEIGHT = 4;
+    constexpr unsigned int PC_MAX_PIECES = 12;
+
+    // Fields Already Shown Not To Clear, Shared By The Solver's Threads, In Megabytes
+    constexpr unsigned int PC_TABLE_MB = 64;
+
+    // Solutions Kept To Be Listed (Every One Is Still Counted)
+    constexpr unsigned int PC_MAX_KEPT_SOLUTIONS = 100000;
+
+
+
+    // ==============================================
+    // HINT SETTINGS
+    // ==============================================
+
+    // Best Follow-Ups Of Each Placement Looked Past The Preview (Against Every Possible Piece) In The Deepest Stage
+    constexpr unsigned int HINT_STAGE_WIDTH = 8;
+
+    // Score Of A Hint Line Where A Piece Can't Be Placed
+    constexpr float HINT_TOP_OUT_SCORE = -1000.0f;
+
+
+
+    // ==============================================
+    // NETWORK EVALUATOR SETTINGS
+    // ==============================================
+
+    // Widest Hidden Layer A Weights File May Have (Sizes Every Scratch Buffer)
+    constexpr unsigned int NN_MAX_HIDDEN = 256;
+
+    // Inputs For Lines Cleared Getting To A Board: 0, 1, 2, 3, Or 4
+    constexpr unsigned int NN_LINE_INPUTS = 5;
+
+    constexpr const char* NN_WEIGHTS_FILE = "weights/board.nn";
+
+
+
+    // ==============================================
+    // SELF-PLAY SETTINGS
+    // ==============================================
+
+    constexpr const char* SELFPLAY_DIRECTORY = "selfplay";
+
+    // Records Compressed Together (The Unit Read For Random Access), And Blocks Per Shard File
+    constexpr unsigned int SELFPLAY_RECORDS_PER_BLOCK = 4096;
+    constexpr unsigned int SELFPLAY_BLOCKS_PER_SHARD = 256;
+
+    // Blocks Allocated Up Front For Games Waiting On The Writer Thread
+    constexpr unsigned int SELFPLAY_QUEUE_BLOCKS = 32;
+
+    // Chance Each Piece Is Placed At Random Instead Of By The Bot, So Data Covers Mistakes Too
+    constexpr float SELFPLAY_EXPLORATION = 0.05f;
+
+
+
+    // ==============================================
+    // OPENING BOOK SETTINGS
+    // ==============================================
+
+    // Looked Up By The Bot & Hints When Present (Built By tetris_book)
+    constexpr const char* BOOK_FILE = "books/opening.book";
+
+    // Pieces Of Every Game The Book Covers (The Whole First Bag), And How Far The Builder Looks Ahead For Each
+    constexpr unsigned int BOOK_PIECES = 7;
+    constexpr unsigned int BOOK_LOOKAHEAD = 4;
+    constexpr unsigned int BOOK_BEAM_WIDTH = 32;
+
+
+
+    // ==============================================
+    // SHADER FILE PATHS
+    // ==============================================
+
+    namespace SHADERS
+    {
+        constexpr const char* BACKGROUND_VERTEX = "./background.vert";
+        constexpr const char* BACKGROUND_FRAGMENT = "./background.frag";
+        constexpr const char* TEXT_VERTEX = "./text.vert";
+        constexpr const char* TEXT_FRAGMENT = "./text.frag";
+    }
+
+
+}
\ No newline at end of file
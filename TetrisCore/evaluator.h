@@ -0,0 +1,118 @@
+#pragma once
+
+
+#include <array>
+#include <bitset>
+#include <cstdint>
+#include "bitboard.h"
+#include "config.h"
+
+
+
+// Board Features A Placement Is Judged By
+enum Feature : unsigned int
+{
+    HOLES,              // Empty Cells With Something Above Them
+    AGGREGATE_HEIGHT,   // Sum Of Every Column's Height
+    BUMPINESS,          // Sum Of Height Differences Between Neighbouring Columns
+    WELLS,              // Sum Of How Far Each Column Sits Below Both Neighbours (Walls Count As Tall)
+    LINES_CLEARED,      // Lines Cleared Getting Here
+    FEATURE_COUNT
+};
+
+using FeatureVector = std::array<float, FEATURE_COUNT>;
+
+// Worth Of Each Feature, Indexed By Feature
+using EvalWeights = std::array<float, FEATURE_COUNT>;
+
+constexpr EvalWeights DEFAULT_WEIGHTS =
+{
+    CONFIG::BOT_WEIGHTS::HOLES,
+    CONFIG::BOT_WEIGHTS::AGGREGATE_HEIGHT,
+    CONFIG::BOT_WEIGHTS::BUMPINESS,
+    CONFIG::BOT_WEIGHTS::WELLS,
+    CONFIG::BOT_WEIGHTS::LINES_CLEARED
+};
+
+
+/*
+
+    Desc: Measures Every Feature Of A Board In One Pass From The Top Row Down,
+    Keeping A Mask Of Columns Already Covered So Holes In A Row Are One AND And
+    One Population Count.
+
+    Preconditions:
+        1.) None
+
+    Postconditions:
+        1.) Returns The Board's Features, With LINES_CLEARED Set To lines.
+
+*/
+template <unsigned int Rows, unsigned int Cols>
+FeatureVector extractFeatures(const BitBoard<Rows, Cols>& board, unsigned int lines)
+{
+
+    std::array<unsigned int, Cols> heights{};
+    std::uint32_t covered = 0;
+    unsigned int holes = 0;
+
+    for (unsigned int row = 0; row < Rows; ++row) {
+        const std::uint32_t occupied = board.getRow(row);
+
+        holes += static_cast<unsigned int>(std::bitset<32>(covered & ~occupied).count());
+
+        // Columns Whose Top Block Is In This Row
+        std::uint32_t tops = occupied & ~covered;
+        for (unsigned int col = 0; tops; ++col, tops >>= 1) {
+            if (tops & 1u) heights[col] = Rows - row;
+        }
+        covered |= occupied;
+    }
+
+    unsigned int aggregate = 0, bumpiness = 0, wells = 0;
+    for (unsigned int col = 0; col < Cols; ++col) {
+        aggregate += heights[col];
+
+        const unsigned int left = col > 0 ? heights[col - 1] : Rows;
+        const unsigned int right = col + 1 < Cols ? heights[col + 1] : Rows;
+        const unsigned int rim = left < right ? left : right;
+        if (rim > heights[col]) wells += rim - heights[col];
+
+        if (col + 1 < Cols) bumpiness += heights[col] > heights[col + 1] ? heights[col] - heights[col + 1] : heights[col + 1] - heights[col];
+    }
+
+    FeatureVector features{};
+    features[HOLES] = static_cast<float>(holes);
+    features[AGGREGATE_HEIGHT] = static_cast<float>(aggregate);
+    features[BUMPINESS] = static_cast<float>(bumpiness);
+    features[WELLS] = static_cast<float>(wells);
+    features[LINES_CLEARED] = static_cast<float>(lines);
+    return features;
+
+}
+
+
+/*
+
+    Desc: Scores A Board As The Weighted Sum Of Its Features.
+
+    Preconditions:
+        1.) None
+
+    Postconditions:
+        1.) Returns The Board's Worth Under weights (Higher Is Better).
+
+*/
+template <unsigned int Rows, unsigned int Cols>
+float evaluateBoard(const BitBoard<Rows, Cols>& board, unsigned int lines, const EvalWeights& weights = DEFAULT_WEIGHTS)
+{
+
+    const FeatureVector features = extractFeatures(board, lines);
+
+    float score = 0.0f;
+    for (unsigned int feature = 0; feature < FEATURE_COUNT; ++feature) {
+        score += weights[feature] * features[feature];
+    }
+    return score;
+
+}
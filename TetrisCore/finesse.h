@@ -0,0 +1,249 @@
+#pragma once
+
+
+#include <array>
+#include <cstdint>
+#include "bitboard.h"
+#include "gamecore.h"
+#include "gamerecord.h"
+#include "movegen.h"
+#include "pieces.h"
+#include "config.h"
+
+
+
+/*
+
+    Desc: Fewest Shifts & Rotations Taking Each Piece From Its Spawn To Each
+    Rotation & Column With Nothing In The Way, Indexed [piece][rotation][col]
+    (UNREACHABLE Where The Piece Doesn't Fit). Dropping Isn't Counted: One Drop
+    Finishes Any Placement, And The Timer Can Do It Instead.
+
+*/
+template <unsigned int Cols>
+struct FinesseTable
+{
+
+    static constexpr std::uint8_t UNREACHABLE = 0xFF;
+
+    std::uint8_t keys[PIECE_COUNT][ROTATION_COUNT][Cols];
+
+    constexpr std::uint8_t get(unsigned int piece, unsigned int rotation, unsigned int col) const
+    {
+        return keys[piece][rotation][col];
+    }
+
+};
+
+
+/*
+
+    Desc: Builds A FinesseTable At Compile Time By Breadth First Search Over Every
+    Rotation & Column Of Each Piece From Its Spawn, Moving The Way GameCore Does
+    (Shifts One Column, Rotations Clockwise In Place).
+
+    Preconditions:
+        1.) None
+
+    Postconditions:
+        1.) Returns The Table, With Rotations Covering The Same Cells Sharing Their Fewest Keys.
+
+*/
+template <unsigned int Cols>
+constexpr FinesseTable<Cols> makeFinesseTable()
+{
+
+    constexpr PieceTable table = makePieceTable(Cols);
+    FinesseTable<Cols> finesse{};
+
+    for (unsigned int piece = 0; piece < PIECE_COUNT; ++piece) {
+
+        std::uint8_t distance[ROTATION_COUNT][Cols]{};
+        for (unsigned int rotation = 0; rotation < ROTATION_COUNT; ++rotation) {
+            for (unsigned int col = 0; col < Cols; ++col) {
+                distance[rotation][col] = FinesseTable<Cols>::UNREACHABLE;
+            }
+        }
+
+        // Queue Of (rotation, col) States, Packed As rotation * Cols + col
+        unsigned int queue[ROTATION_COUNT * Cols]{};
+        unsigned int head = 0, tail = 0;
+
+        const unsigned int spawn = table.get(piece, 0).spawnCol;
+        distance[0][spawn] = 0;
+        queue[tail++] = spawn;
+
+        while (head < tail) {
+            const unsigned int rotation = queue[head] / Cols, col = queue[head] % Cols;
+            head++;
+
+            const unsigned int moves[3][2] = {
+                { rotation, col - 1 },
+                { rotation, col + 1 },
+                { (rotation + 1) % ROTATION_COUNT, col }
+            };
+            for (unsigned int move = 0; move < 3; ++move) {
+                const unsigned int nextRotation = moves[move][0], nextCol = moves[move][1];
+
+                // Unsigned, So Shifting Off The Left Wraps Past Cols Too
+                if (nextCol >= Cols || nextCol + table.get(piece, nextRotation).width > Cols) continue;
+                if (distance[nextRotation][nextCol] != FinesseTable<Cols>::UNREACHABLE) continue;
+
+                distance[nextRotation][nextCol] = static_cast<std::uint8_t>(distance[rotation][col] + 1);
+                queue[tail++] = nextRotation * Cols + nextCol;
+            }
+        }
+
+        for (unsigned int rotation = 0; rotation < ROTATION_COUNT; ++rotation) {
+            for (unsigned int col = 0; col < Cols; ++col) {
+                std::uint8_t best = FinesseTable<Cols>::UNREACHABLE;
+                for (unsigned int other = 0; other < ROTATION_COUNT; ++other) {
+                    if (canonicalRotation(piece, other) == canonicalRotation(piece, rotation) && distance[other][col] < best)
+                    {
+                        best = distance[other][col];
+                    }
+                }
+                finesse.keys[piece][rotation][col] = best;
+            }
+        }
+    }
+
+    return finesse;
+
+}
+
+
+// Table For A Board Cols Wide
+template <unsigned int Cols>
+constexpr FinesseTable<Cols> FINESSE_TABLE = makeFinesseTable<Cols>();
+
+static_assert(FINESSE_TABLE<10>.get(1, 0, 4) == 0 && FINESSE_TABLE<10>.get(1, 0, 0) == 4 && FINESSE_TABLE<10>.get(0, 2, 3) == 0, "O & I Placements Should Cost Their Shifts Alone");
+
+
+/*
+
+    Desc: How Cleanly Pieces Were Moved Into Place. Keys Are Shifts & Rotations;
+    A Piece Is Faulty If It Took More Than The Fewest Possible.
+
+*/
+struct FinesseStats
+{
+
+    std::uint64_t pieces = 0;
+    std::uint64_t keys = 0;             // Shifts & Rotations Pressed
+    std::uint64_t minimalKeys = 0;      // Fewest That Would Have Done
+    std::uint64_t wastedKeys = 0;       // Pressed Beyond The Fewest, Summed Per Piece
+    std::uint64_t faultyPieces = 0;
+    std::uint64_t tucks = 0;            // Placements A Straight Drop Can't Reach
+
+    double wastedRate() const { return keys ? static_cast<double>(wastedKeys) / keys : 0.0; }
+    double faultRate() const { return pieces ? static_cast<double>(faultyPieces) / pieces : 0.0; }
+
+    FinesseStats& operator+=(const FinesseStats& other)
+    {
+        pieces += other.pieces;
+        keys += other.keys;
+        minimalKeys += other.minimalKeys;
+        wastedKeys += other.wastedKeys;
+        faultyPieces += other.faultyPieces;
+        tucks += other.tucks;
+        return *this;
+    }
+
+};
+
+
+/*
+
+    Desc: Replays A Recorded Game On A Headless GameCore And Compares The Shifts &
+    Rotations Spent On Each Piece Against The Fewest Reaching Where It Locked.
+    Placements A Straight Drop Lands On Take Their Fewest From FINESSE_TABLE;
+    Tucks & Spins Under Overhangs Take Theirs From generator's Path On The Board
+    As It Was, Which Is Short But, Unlike The Table, Not Promised To Be Shortest.
+
+    Preconditions:
+        1.) record Was Played On A Rows x Cols Board.
+
+    Postconditions:
+        1.) Returns The Game's Stats; The Pieces Locked Before The Record Ends Are Counted.
+
+*/
+template <unsigned int Rows, unsigned int Cols>
+FinesseStats analyzeFinesse(const GameRecord& record, MoveGenerator<Rows, Cols>& generator)
+{
+
+    using Bits = BitBoard<Rows, Cols>;
+
+    GameCore<Rows, Cols> core(record.seed);
+    FinesseStats stats;
+    unsigned int keys = 0;
+    std::array<char, MoveGenerator<Rows, Cols>::MAX_PATH_LENGTH> path{};
+
+    for (char input : record.inputs) {
+
+        // Keys Pressed Without A Piece To Move Do Nothing
+        if (input == MOVE_INPUT::LEFT || input == MOVE_INPUT::RIGHT || input == MOVE_INPUT::ROTATE)
+        {
+            if (core.isPieceActive()) keys++;
+            if (input == MOVE_INPUT::ROTATE) core.rotateActivePiece();
+            else core.shiftActivePiece(input);
+            continue;
+        }
+        if (input == MOVE_INPUT::HARD_DROP)
+        {
+            core.shiftActivePiece(input);
+            continue;
+        }
+
+        // Soft Drops & Gravity Both Step; Note Where The Piece Is In Case This Locks It
+        const bool wasActive = core.isPieceActive();
+        const unsigned int piece = core.getActivePiece(), rotation = core.getActiveRotation();
+        const unsigned int row = core.getActiveRow(), col = core.getActiveCol();
+        const unsigned int locked = core.getPiecesLocked();
+        const Bits before = core.getOccupancy();
+
+        core.step();
+
+        if (!wasActive || core.getPiecesLocked() == locked) continue;
+
+        // Would A Straight Drop From The Top Have Landed Here?
+        const PieceRotation& shape = PIECE_TABLE_FOR<Cols>.get(piece, rotation);
+        unsigned int landing = 0;
+        while (!before.collides(shape.rows, shape.height, landing + 1, col)) ++landing;
+
+        unsigned int minimal = FINESSE_TABLE<Cols>.get(piece, rotation, col);
+        if (landing != row || before.collides(shape.rows, shape.height, 0, col) || minimal == FinesseTable<Cols>::UNREACHABLE)
+        {
+            // A Tuck Or Spin, So Find The Generator's Way There
+            minimal = keys;
+            generator.generate(before, piece);
+            for (unsigned int i = 0; i < generator.getPlacementCount(); ++i) {
+                const Placement& placement = generator.getPlacement(i);
+                if (placement.row != row || placement.col != col || canonicalRotation(piece, placement.rotation) != canonicalRotation(piece, rotation)) continue;
+
+                const unsigned int length = generator.getPath(placement, path.data());
+                minimal = 0;
+                for (unsigned int j = 0; j < length; ++j) {
+                    if (path[j] != MOVE_INPUT::SOFT_DROP && path[j] != MOVE_INPUT::HARD_DROP) minimal++;
+                }
+                break;
+            }
+            stats.tucks++;
+        }
+
+        stats.pieces++;
+        stats.keys += keys;
+        stats.minimalKeys += minimal;
+        if (keys > minimal)
+        {
+            stats.wastedKeys += keys - minimal;
+            stats.faultyPieces++;
+        }
+        keys = 0;
+
+        if (core.isGameOver()) break;
+    }
+
+    return stats;
+
+}
@@ -0,0 +1,22 @@
+#include "gamecore.h"
+
+
+/*
+
+    Desc: Out-Of-Line Definitions For CoreListener So Its Virtual Table Lives
+    In tetris_core, Every Handler Defaulting To Doing Nothing.
+
+*/
+CoreListener::~CoreListener() {}
+void CoreListener::onCellChanged(unsigned int, unsigned int, Cell) {}
+void CoreListener::onRowMoved(unsigned int, unsigned int) {}
+void CoreListener::onRowCleared(unsigned int) {}
+void CoreListener::onNextPieceChanged(unsigned int, Cell) {}
+void CoreListener::onLinesCleared(unsigned int, unsigned int, bool) {}
+void CoreListener::onGameOver() {}
+
+
+// Every Board Size We Support Is Its Own Instantiation
+template class GameCore<CONFIG::BOARD_ROWS, CONFIG::BOARD_COLS>;
+template class GameCore<CONFIG::TALL_BOARD_ROWS, CONFIG::BOARD_COLS>;
+template class GameCore<CONFIG::BOARD_ROWS, CONFIG::WIDE_BOARD_COLS>;
@@ -0,0 +1,1053 @@
+#pragma once
+
+
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include "block.h"
+#include "bitboard.h"
+#include "pieces.h"
+#include "piecestream.h"
+#include "zobrist.h"
+#include "config.h"
+
+
+
+/*
+
+    Desc: Interface For Anything Wanting To Watch A GameCore's State Changes (Mainly
+    Our Board Renderer). Every Handler Defaults To Doing Nothing So A Listener Only
+    Overrides What It Cares About, And A GameCore Without A Listener (Headless Runs)
+    Skips Notifying Entirely.
+
+*/
+class CoreListener
+{
+
+    public:
+
+        virtual ~CoreListener();
+
+        // A Single Cell Was Painted Or Cleared; cell Is What It Should Now Be Drawn As
+        virtual void onCellChanged(unsigned int row, unsigned int col, Cell cell);
+
+        // Every Cell Of fromRow Was Moved Into toRow (fromRow Is Left As-Is)
+        virtual void onRowMoved(unsigned int fromRow, unsigned int toRow);
+
+        // Every Cell Of row Was Cleared To EMPTY
+        virtual void onRowCleared(unsigned int row);
+
+        // The Upcoming Piece Shown In The Preview Changed; Each Of Its Blocks Is Drawn As cell
+        virtual void onNextPieceChanged(unsigned int piece, Cell cell);
+
+        // lines Rows Were Completed, Awarding points And Possibly A Level
+        virtual void onLinesCleared(unsigned int lines, unsigned int points, bool levelUp);
+
+        // A New Piece Could Not Be Placed
+        virtual void onGameOver();
+
+};
+
+
+
+/*
+
+    Desc: The Rules Of A Game Of Tetris Without Any Rendering. Holds The Locked Cells,
+    The Active And Upcoming Piece, And The Score, Moving Pieces And Clearing Lines On
+    Request. It Has No Dependency On OpenGL Or GLFW So Games Can Be Simulated Headless;
+    Renderers Attach A CoreListener To Mirror State Changes Onto The Screen. Board
+    Dimensions Are Template Parameters, So All Cells Live In One Inline std::array
+    Of One-Byte Cells And Each Board Size (See gamecore.cpp) Is Its Own Instantiation.
+
+*/
+template <unsigned int Rows, unsigned int Cols>
+class GameCore
+{
+
+    public:
+
+        using Bits = BitBoard<Rows, Cols>;
+
+        static_assert(Cols >= PIECE_CELLS, "Board Must Fit The Horizontal I");
+        static_assert(Rows >= PIECE_CELLS, "Board Must Fit The Vertical I");
+
+    private:
+
+        // Current Game Of Tetris
+        Bits occupancy;                              // Locked Cells, One Row Mask Per Row
+        std::uint64_t hash;                          // Zobrist Hash Of occupancy, Kept In Step With It
+        std::array<Cell, Rows * Cols> cells;         // State & Palette Index Of Every Cell, Row-Major
+        bool hasActivePiece;                         // If A Piece Is Currently Dropping
+        unsigned int activePiece, activeRotation;    // Index Into PIECE_TABLE Of The Active Piece
+        unsigned int activePieceRow, activePieceCol; // Position Of The Active Piece On The Board
+        Cell activePieceCell;                        // What Each Block Of The Active Piece Is Drawn As
+        std::array<unsigned int, Cols> surfaceRow;   // Highest Occupied Row Of Each Column (Rows If Empty)
+
+        // Ghost Piece Currently Drawn
+        bool hasGhost;
+        const PieceRotation* ghostShape;
+        unsigned int ghostRow, ghostCol;
+
+        // Suggested Placement Of The Active Piece, Drawn As The Ghost While Set
+        bool hasHint;
+        unsigned int hintRotation, hintRow, hintCol;
+
+        // Next Up Shape
+        unsigned int nextPiece;                      // Index Into PIECE_TABLE Of The Next Piece
+        Cell nextShapeCell;
+
+        // Piece Stream
+        PieceStream stream;
+
+        // Scoring
+        unsigned int score, linesCleared, level;
+        unsigned int piecesLocked;                   // Pieces Locked Into The Board This Game
+        bool gameOver;
+
+        // Watcher Of Our State Changes (Null When Headless)
+        CoreListener* listener;
+
+
+        /*
+
+            Desc: Deals The Next Shape To Come Up After The Current Shape Is Dropped,
+            Also Randomly Selecting One Of The Palette's Piece Colors For It.
+
+            Preconditions:
+                1.) None
+
+            Postconditions:
+                1.) This->nextPiece Will Be Now The Next Piece Of The Bag
+                2.) This->nextPiece Will Be Colored A Random Color
+                3.) The Listener Is Notified Of The New Upcoming Piece
+
+        */
+        void generateNextShape()
+        {
+
+            nextPiece = stream.deal(nextShapeCell);
+
+            if (listener) listener->onNextPieceChanged(nextPiece, nextShapeCell);
+
+        }
+
+
+        /*
+
+            Desc: Sets A Single Cell, Notifying The Listener.
+
+            Preconditions:
+                1.) row & col Are Within The Board.
+
+            Postconditions:
+                1.) The Cell At (row, col) Is cell.
+
+        */
+        void setCell(unsigned int row, unsigned int col, Cell cell)
+        {
+
+            cells[row * Cols + col] = cell;
+            if (listener) listener->onCellChanged(row, col, cell);
+
+        }
+
+
+        /*
+
+            Desc: Returns The Current Rotation State Of The Active Piece.
+
+            Preconditions:
+                1.) This->activePiece & This->activeRotation Index A Valid PIECE_TABLE Entry.
+
+            Postconditions:
+                1.) Returns The Active Piece's Entry In PIECE_TABLE.
+
+        */
+        const PieceRotation& activeShape() const
+        {
+
+            return PIECE_TABLE_FOR<Cols>.get(activePiece, activeRotation);
+
+        }
+
+
+        /*
+
+            Desc: Tests Whether The Active Shape Would Collide With The Board Boundaries
+            Or Any Locked Cell If Its Top-Left Corner Was At (row, col).
+
+            Preconditions:
+                1.) This->activePiece & This->activeRotation Index A Valid PIECE_TABLE Entry.
+
+            Postconditions:
+                1.) Returns True If The Active Shape Cannot Occupy (row, col).
+
+        */
+        bool activeShapeCollides(int row, int col) const
+        {
+
+            return occupancy.collides(activeShape().rows, activeShape().height, row, col);
+
+        }
+
+
+        /*
+
+            Desc: Tests Whether The Active Piece Covers A Cell.
+
+            Preconditions:
+                1.) An Active Piece Exists On The Board.
+
+            Postconditions:
+                1.) Returns True If (row, col) Is One Of The Active Piece's Cells.
+
+        */
+        bool activePieceCovers(unsigned int row, unsigned int col) const
+        {
+
+            const PieceRotation& shape = activeShape();
+            return row >= activePieceRow && row < activePieceRow + shape.height && col >= activePieceCol &&
+                ((shape.rows[row - activePieceRow] >> (col - activePieceCol)) & 1u);
+
+        }
+
+
+        /*
+
+            Desc: Draws The Active Piece At Its Current Position In Its Color. The Active
+            Piece Isn't Locked Yet, So The Cells Keep Their State And Only The Listener
+            Sees The Piece.
+
+            Preconditions:
+                1.) An Active Piece Exists On The Board.
+
+            Postconditions:
+                1.) The Active Piece's Cells Are Reported As This->activePieceCell.
+
+        */
+        void paintActivePiece()
+        {
+
+            if (!listener) return;
+
+            const PieceRotation& shape = activeShape();
+            for (unsigned int cell = 0; cell < PIECE_CELLS; ++cell) {
+                listener->onCellChanged(activePieceRow + shape.cellRow[cell], activePieceCol + shape.cellCol[cell], activePieceCell);
+            }
+
+        }
+
+
+        /*
+
+            Desc: Erases The Active Piece From Its Current Position.
+
+            Preconditions:
+                1.) An Active Piece Exists On The Board.
+
+            Postconditions:
+                1.) The Active Piece's Cells Are Cleared And Marked EMPTY.
+
+        */
+        void eraseActivePiece()
+        {
+
+            const PieceRotation& shape = activeShape();
+            for (unsigned int cell = 0; cell < PIECE_CELLS; ++cell) {
+                setCell(activePieceRow + shape.cellRow[cell], activePieceCol + shape.cellCol[cell], EMPTY_CELL);
+            }
+
+        }
+
+
+        /*
+
+            Desc: Clears The Ghost Piece We Last Drew, If Any. We Remember Where It Was
+            So Only Its Own Cells Are Touched; Cells Something Else Has Since Claimed
+            Are Left Alone. The Active Piece May Have Moved Or Turned Onto The Ghost
+            (A Hint Can Sit Anywhere, And A Turn Can Reach Down Into The Landing Spot),
+            So Cells It Covers Are Shown As The Piece Rather Than Emptied On Screen.
+
+            Preconditions:
+                1.) None
+
+            Postconditions:
+                1.) No Cell Is In The GHOST State.
+                2.) The Listener Still Sees The Active Piece Whole.
+
+        */
+        void clearGhost()
+        {
+
+            if (!hasGhost) return;
+
+            for (unsigned int cell = 0; cell < PIECE_CELLS; ++cell) {
+                unsigned int row = ghostRow + ghostShape->cellRow[cell];
+                unsigned int col = ghostCol + ghostShape->cellCol[cell];
+                if (cellState(cells[row * Cols + col]) == GHOST)
+                {
+                    cells[row * Cols + col] = EMPTY_CELL;
+                    if (listener) listener->onCellChanged(row, col, hasActivePiece && activePieceCovers(row, col) ? activePieceCell : EMPTY_CELL);
+                }
+            }
+            hasGhost = false;
+
+        }
+
+
+        /*
+
+            Desc: Finds The Row The Active Piece Would Land On If Dropped Straight Down,
+            One Row At A Time.
+
+            Preconditions:
+                1.) An Active Piece Exists On The Board.
+
+            Postconditions:
+                1.) Returns The Lowest Row The Active Piece Fits At Without Passing Through Anything.
+
+        */
+        unsigned int scanLandingRow() const
+        {
+
+            unsigned int landing = activePieceRow;
+            while (!activeShapeCollides(landing + 1, activePieceCol)) {
+                landing++;
+            }
+            return landing;
+
+        }
+
+
+        /*
+
+            Desc: Finds The Row The Active Piece Would Land On If Dropped Straight Down
+            Using The Surface Of The Stack: In Each Of Its Columns The Piece Can Fall Until
+            Its Bottom Profile Meets This->surfaceRow, So The Landing Row Is The Tightest
+            Of Those. Only If The Piece Is Tucked Below The Surface (Under An Overhang)
+            Do We Fall Back To Scanning Row By Row.
+
+            Preconditions:
+                1.) An Active Piece Exists On The Board.
+
+            Postconditions:
+                1.) Returns The Lowest Row The Active Piece Fits At Without Passing Through Anything.
+
+        */
+        unsigned int landingRow() const
+        {
+
+            const PieceRotation& shape = activeShape();
+            unsigned int landing = Rows;
+
+            for (unsigned int j = 0; j < shape.width; ++j) {
+                unsigned int surface = surfaceRow[activePieceCol + j];
+                if (activePieceRow + shape.bottomRow[j] >= surface)
+                {
+                    return scanLandingRow();
+                }
+                landing = std::min(landing, surface - 1 - shape.bottomRow[j]);
+            }
+
+            return landing;
+
+        }
+
+
+        /*
+
+            Desc: Rebuilds This->surfaceRow From The Occupancy Rows.
+
+            Preconditions:
+                1.) None
+
+            Postconditions:
+                1.) Every Column's Surface Is Its Highest Occupied Row (Rows If Empty).
+
+        */
+        void recomputeSurface()
+        {
+
+            surfaceRow.fill(Rows);
+
+            unsigned int found = 0;
+            for (unsigned int row = 0; row < Rows && found < Cols; ++row) {
+                typename Bits::RowMask mask = occupancy.getRow(row);
+                for (unsigned int col = 0; mask && col < Cols; ++col) {
+                    if (((mask >> col) & 1u) && surfaceRow[col] == Rows)
+                    {
+                        surfaceRow[col] = row;
+                        found++;
+                    }
+                }
+            }
+
+        }
+
+
+        /*
+
+            Desc: Empties Every Cell Of The Board.
+
+            Preconditions:
+                1.) None
+
+            Postconditions:
+                1.) Every Cell Is EMPTY And Every Column's Surface Is At The Floor.
+
+        */
+        void clearBoard()
+        {
+
+            cells.fill(EMPTY_CELL);
+            if (listener)
+            {
+                for (unsigned int i = 0; i < Rows; ++i) {
+                    listener->onRowCleared(i);
+                }
+            }
+            occupancy.clear();
+            hash = 0;
+            surfaceRow.fill(Rows);
+            hasGhost = false;
+            hasHint = false;
+
+        }
+
+
+        /*
+
+            Desc: Swaps The Upcoming Piece In To Be The Active Piece Being Dropped,
+            Checking If We Have A Game Over Based On If It Is Able To Place The Given
+            Shape On The Grid. Likewise, Will Place The Ghost Piece For The Given Shape.
+
+            Preconditions:
+                1.) This->nextPiece Contains A Given Piece
+
+            Postconditions:
+                1.) Will Swap Out This->nextPiece To Active, This->activePiece
+                2.) This->nextPiece Will Be Set To A New Piece
+                3.) If Game Isn't Over, Will Draw The Active Piece At The Origin
+                4.) If Game Isn't Over, Will Place The Ghost Piece
+                5.) If Game Is Over, Will Return False And Set This->gameOver
+                6.) If Game Isn't Over, Will Return True
+
+        */
+        bool startNewPiece()
+        {
+
+            // Move Next Shape To Current
+            activePiece = nextPiece;
+            activeRotation = 0;
+            activePieceCell = nextShapeCell;
+            hasActivePiece = true;
+
+            // Generate New Next Shape
+            generateNextShape();
+
+            // Set Starting Position (Center Top)
+            activePieceRow = 0;
+            activePieceCol = activeShape().spawnCol;
+
+            // Check If We Can Place The New Shape (Game Over Check)
+            if (activeShapeCollides(activePieceRow, activePieceCol))
+            {
+                gameOver = true;
+                return false;
+            }
+
+            // Place The New Shape On Board
+            paintActivePiece();
+
+            // Generate Ghost Piece
+            ghostPiece();
+            return true;
+
+        }
+
+
+        /*
+
+            Desc: Copies A Row Of Cells Over Another Row, Notifying The Listener.
+
+            Preconditions:
+                1.) fromRow & toRow Are Within The Board.
+
+            Postconditions:
+                1.) toRow Holds fromRow's Cells And Occupancy; fromRow Is Unchanged.
+                2.) this->hash Still Matches this->occupancy.
+
+        */
+        void moveRow(unsigned int fromRow, unsigned int toRow)
+        {
+
+            for (unsigned int c = 0; c < Cols; ++c) {
+                cells[toRow * Cols + c] = cells[fromRow * Cols + c];
+            }
+            hash ^= hashRow<Rows, Cols>(toRow, occupancy.getRow(toRow)) ^ hashRow<Rows, Cols>(toRow, occupancy.getRow(fromRow));
+            occupancy.moveRow(fromRow, toRow);
+
+            if (listener) listener->onRowMoved(fromRow, toRow);
+
+        }
+
+
+        /*
+
+            Desc: Empties A Row Of Cells, Notifying The Listener.
+
+            Preconditions:
+                1.) row Is Within The Board.
+
+            Postconditions:
+                1.) Every Cell Of row Is EMPTY.
+                2.) this->hash Still Matches this->occupancy.
+
+        */
+        void clearRow(unsigned int row)
+        {
+
+            for (unsigned int c = 0; c < Cols; ++c) {
+                cells[row * Cols + c] = EMPTY_CELL;
+            }
+            hash ^= hashRow<Rows, Cols>(row, occupancy.getRow(row));
+            occupancy.clearRow(row);
+
+            if (listener) listener->onRowCleared(row);
+
+        }
+
+
+        /*
+
+            Desc: Checks For Completed Horizontal Lines, Clears Them, Shifts Remaining
+            Blocks Down, And Updates Score And Level Accordingly. Only The Rows The
+            Locked Piece Covers Can Be Completed, And The Rows Above Are Compacted In A
+            Single Pass So Every Surviving Row Moves Once, Straight To Its Final Row.
+            The Pass Stops At The Top Of The Stack Rather Than The First Empty Row, Since
+            A Loaded Board May Have Rows Floating Over Empty Ones; Those Drop By The Same
+            Count As Everything Else, Just As BitBoard::clearFullRows Drops Them.
+
+            Preconditions:
+                1.) The Active Piece Has Just Been Locked Into This->occupancy.
+
+            Postconditions:
+                1.) Identifies And Clears All Completed Horizontal Lines.
+                2.) Shifts All Blocks Above Cleared Lines Down Appropriately.
+                3.) Updates Score Based On Number Of Lines Cleared.
+                4.) Increments Level Every CONFIG::LINES_PER_LEVEL Lines Cleared.
+                5.) Notifies The Listener Of The Points Awarded.
+
+        */
+        void checkForPoints()
+        {
+
+            // Find The Lowest Completed Row Under The Locked Piece
+            int lowestFull = -1;
+            for (unsigned int i = activeShape().height; i > 0; --i) {
+                if (occupancy.isRowFull(activePieceRow + i - 1))
+                {
+                    lowestFull = activePieceRow + i - 1;
+                    break;
+                }
+            }
+
+            if (lowestFull < 0)
+            {
+                return;
+            }
+
+            // Walk Up From It To The Top Of The Stack (The Locked Piece Already Raised The Surface),
+            // Dropping Every Surviving Row Onto The Next Free Row
+            const int top = static_cast<int>(*std::min_element(surfaceRow.begin(), surfaceRow.end()));
+            unsigned int rowsCleared = 0;
+            int target = lowestFull;
+            int source = lowestFull;
+            for (; source >= top; --source) {
+                if (occupancy.isRowFull(source))
+                {
+                    rowsCleared++;
+                    continue;
+                }
+
+                moveRow(source, target);
+                target--;
+            }
+
+            // Rows Between The Last Source And The Last Target Are Now Empty
+            for (int row = target; row > source; --row) {
+                clearRow(row);
+            }
+            recomputeSurface();
+
+            // Add Score Based On Rows Cleared
+            unsigned int points = rowsCleared * CONFIG::POINTS_PER_LINE;
+            this->score += points;
+            this->linesCleared += rowsCleared;
+
+            bool levelUp = !(this->linesCleared % CONFIG::LINES_PER_LEVEL);
+            if (levelUp)
+            {
+                this->level++;
+            }
+
+            if (listener) listener->onLinesCleared(rowsCleared, points, levelUp);
+
+        }
+
+
+    public:
+
+        /*
+
+            Desc: Takes In The Seed Of Our Piece Stream; Equal Seeds Deal Equal Pieces.
+
+            Preconditions:
+                1.) None
+
+            Postconditions:
+                1.) Initializes An Empty Game Grid With No Active Piece.
+                2.) Seeds This->stream With seed And Generates Initial Next Shape.
+
+        */
+        explicit GameCore(std::uint64_t seed = 0)
+            : occupancy(), hash(0), cells{}, hasActivePiece(false),
+            activePiece(0), activeRotation(0), activePieceRow(0), activePieceCol(0), activePieceCell(EMPTY_CELL),
+            surfaceRow{}, hasGhost(false), ghostShape(nullptr), ghostRow(0), ghostCol(0),
+            hasHint(false), hintRotation(0), hintRow(0), hintCol(0),
+            nextPiece(0), nextShapeCell(EMPTY_CELL), stream(seed), score(0), linesCleared(0), level(1), piecesLocked(0), gameOver(false),
+            listener(nullptr)
+        {
+
+            surfaceRow.fill(Rows);
+
+            // Generate The First Shape
+            generateNextShape();
+
+        }
+
+
+        /*
+
+            Desc: Attaches A Listener To Be Notified Of Every State Change, Replaying
+            The Current Upcoming Piece To It.
+
+            Preconditions:
+                1.) newListener Outlives This GameCore Or Is Detached First (nullptr).
+
+            Postconditions:
+                1.) This->listener Is newListener.
+
+        */
+        void setListener(CoreListener* newListener)
+        {
+
+            listener = newListener;
+            if (listener) listener->onNextPieceChanged(nextPiece, nextShapeCell);
+
+        }
+
+
+        /*
+
+            Desc: Resets The Entire Game State For A New Game, Clearing The Game Grid,
+            Scoring, And The Active Piece.
+
+            Preconditions:
+                1.) None
+
+            Postconditions:
+                1.) Every Cell Is EMPTY And The Score, Lines, And Level Are Defaulted
+                2.) Clears Out The Current Active Piece To Be Dropped
+                3.) Will Grab A Upcoming Shape For The Next Game
+
+        */
+        void reset()
+        {
+
+            clearBoard();
+
+            hasActivePiece = false;
+            score = 0;
+            linesCleared = 0;
+            level = 1;
+            piecesLocked = 0;
+            gameOver = false;
+
+            generateNextShape();
+
+        }
+
+
+        /*
+
+            Desc: Resets The Game Like reset(), But First Restarts The Piece Stream
+            From newSeed So The Game That Follows Can Be Replayed Exactly.
+
+            Preconditions:
+                1.) None
+
+            Postconditions:
+                1.) This->stream Restarts From newSeed.
+                2.) The Game Is Reset As By reset().
+
+        */
+        void reset(std::uint64_t newSeed)
+        {
+
+            stream.reseed(newSeed);
+
+            reset();
+
+        }
+
+
+        /*
+
+            Desc: Replaces The Locked Cells With A Board Built Elsewhere (A Puzzle Or A
+            Reference Position), Drawing Every Occupied Cell As cell.
+
+            Preconditions:
+                1.) No Piece Is Active.
+                2.) cell's State Is OCCUPIED.
+
+            Postconditions:
+                1.) This->occupancy Is bits, And The Hash & Surface Match It.
+                2.) The Score, Piece Stream, And Upcoming Piece Are Untouched.
+
+        */
+        void loadBoard(const Bits& bits, Cell cell)
+        {
+
+            clearBoard();
+
+            for (unsigned int row = 0; row < Rows; ++row) {
+                const typename Bits::RowMask mask = bits.getRow(row);
+                for (unsigned int col = 0; mask && col < Cols; ++col) {
+                    if ((mask >> col) & 1u) setCell(row, col, cell);
+                }
+            }
+            occupancy = bits;
+            hash = hashBoard(occupancy);
+            recomputeSurface();
+
+        }
+
+
+        /*
+
+            Desc: Advances The Game State By One Step, Managing Active Piece Movement,
+            Collision Detection, Line Clearing, And New Piece Generation.
+
+            Preconditions:
+                1.) None
+
+            Postconditions:
+                1.) Moves Active Piece Down One Row If Possible.
+                2.) Finalizes Piece Position And Checks For Completed Lines.
+                3.) Generates New Piece If Current Piece Has Landed.
+                4.) If No New Piece Can Be Placed, Clears The Board And Flags Game Over.
+
+        */
+        void step()
+        {
+
+            // If No Active Shape, Start A New One
+            if (!hasActivePiece)
+            {
+
+                if (!startNewPiece())
+                {
+                    // Game Over - Clear The Board
+                    clearBoard();
+
+                    if (listener) listener->onGameOver();
+                }
+                return; // New Piece Placed, Wait For Next Step
+            }
+
+            // Try To Move Current Shape Down
+            if (!activeShapeCollides(activePieceRow + 1, activePieceCol))
+            {
+                eraseActivePiece();
+                activePieceRow++;
+                paintActivePiece();
+
+                // Update Ghost Piece
+                ghostPiece();
+            }
+            else
+            {
+                // Shape Has Landed - Finalize It (Any Hint Was For This Piece)
+                clearGhost();
+                hasHint = false;
+
+                // Mark Cells As Occupied
+                const PieceRotation& shape = activeShape();
+                occupancy.place(shape.rows, shape.height, activePieceRow, activePieceCol);
+                for (unsigned int cell = 0; cell < PIECE_CELLS; ++cell) {
+                    const unsigned int row = activePieceRow + shape.cellRow[cell], col = activePieceCol + shape.cellCol[cell];
+                    setCell(row, col, activePieceCell);
+                    hash ^= ZOBRIST_KEYS<Rows, Cols>.cells[row * Cols + col];
+                }
+
+                // Raise The Surface To The Piece's Top Profile
+                for (unsigned int j = 0; j < shape.width; ++j) {
+                    surfaceRow[activePieceCol + j] = std::min(surfaceRow[activePieceCol + j], activePieceRow + shape.topRow[j]);
+                }
+
+                // Clear The Active Shape So A New One Will Be Generated Next Step
+                hasActivePiece = false;
+                piecesLocked++;
+
+                // Check For Completed Lines
+                checkForPoints();
+            }
+
+        }
+
+
+        /*
+
+            Desc: Moves The Currently Active Tetris Piece In The Specified Direction
+            With Collision Detection And Boundary Checking.
+
+            Preconditions:
+                1.) Direction Parameter Is Valid ('L', 'R', Or 'D').
+
+            Postconditions:
+                1.) Moves Active Piece Left, Right, Or Fast Down If Movement Is Valid.
+                2.) If Movement Is Invalid Due To Collision, No Movement Occurs.
+                3.) If There Is No Active Piece, Nothing Happens.
+
+        */
+        void shiftActivePiece(char direction)
+        {
+
+            // User Shifts Left, Right, Or Fast Down
+            if (!hasActivePiece)
+            {
+                return;
+            }
+
+            switch (direction)
+            {
+
+                case 'L': // Shift Left
+                    // Check If The Shape Fits One Column To The Left
+                    if (!activeShapeCollides(activePieceRow, static_cast<int>(activePieceCol) - 1))
+                    {
+                        eraseActivePiece();
+                        activePieceCol--;
+                        paintActivePiece();
+                    }
+                    break;
+                case 'R': // Shift Right
+                    // Check If The Shape Fits One Column To The Right
+                    if (!activeShapeCollides(activePieceRow, activePieceCol + 1))
+                    {
+                        eraseActivePiece();
+                        activePieceCol++;
+                        paintActivePiece();
+                    }
+                    break;
+                case 'D': // Fast Down
+                    {
+                        // Jump Straight To Where We'd Hit The Bottom Or Another Piece,
+                        // Which Is Exactly Where The Ghost Sits, So Take It Down First
+                        unsigned int landing = landingRow();
+                        clearGhost();
+                        if (landing != activePieceRow)
+                        {
+                            eraseActivePiece();
+                            activePieceRow = landing;
+                        }
+                        paintActivePiece();
+                    }
+                    break;
+            }
+
+        }
+
+
+        /*
+
+            Desc: Rotates The Currently Active Tetris Piece 90 Degrees Clockwise
+            With Collision Detection And Boundary Checking.
+
+            Preconditions:
+                1.) None
+
+            Postconditions:
+                1.) Rotates Active Piece If Rotation Is Valid And No Collisions Occur.
+                2.) If Rotation Is Invalid, Piece Remains In Original Orientation.
+                3.) If There Is No Active Piece, Nothing Happens.
+
+        */
+        void rotateActivePiece()
+        {
+
+            if (!hasActivePiece)
+            {
+                return;
+            }
+
+            // Look Up The Next Clockwise Rotation State
+            unsigned int rotation = (activeRotation + 1) % ROTATION_COUNT;
+            const PieceRotation& rotatedShape = PIECE_TABLE_FOR<Cols>.get(activePiece, rotation);
+
+            // Check If The Rotated Shape Can Fit In The Current Position
+            if (!occupancy.collides(rotatedShape.rows, rotatedShape.height, activePieceRow, activePieceCol))
+            {
+                eraseActivePiece();
+                activeRotation = rotation;
+                paintActivePiece();
+            }
+
+        }
+
+
+        /*
+
+            Desc: Places A Ghost Piece That Shows Where The Active Piece Will Land
+            When Dropped Straight Down, Or Where The Hint Says To Put It While One Is Set.
+
+            Preconditions:
+                1.) None
+
+            Postconditions:
+                1.) Clears Any Previous Ghost Piece From The Board.
+                2.) Calculates The Landing Position For The Active Piece.
+                3.) Marks The Ghost Piece's Cells As GHOST At The Landing Position (Or The Hint's).
+                4.) If Ghost Would Be Too Close To Active Piece, No Ghost Is Placed; A Hint Skips Just The Cells The Piece Covers.
+                5.) If There Is No Active Piece, Nothing Happens.
+
+        */
+        void ghostPiece()
+        {
+
+            if (!hasActivePiece)
+            {
+                return; // No Active Shape, No Ghost Piece
+            }
+
+            if (hasHint)
+            {
+                clearGhost();
+
+                ghostShape = &PIECE_TABLE_FOR<Cols>.get(activePiece, hintRotation);
+                ghostRow = hintRow;
+                ghostCol = hintCol;
+                hasGhost = true;
+
+                for (unsigned int cell = 0; cell < PIECE_CELLS; ++cell) {
+                    const unsigned int row = ghostRow + ghostShape->cellRow[cell], col = ghostCol + ghostShape->cellCol[cell];
+
+                    // Leave The Active Piece Showing Where It Overlaps The Hint
+                    if (!activePieceCovers(row, col)) setCell(row, col, GHOST_CELL);
+                }
+                return;
+            }
+
+            // Find Where The Active Piece Would Land
+            unsigned int landing = landingRow();
+
+            // Clear Any Previous Ghost Piece
+            clearGhost();
+
+            if (landing - activePieceRow < CONFIG::MIN_GHOST_DISTANCE)
+            {
+                // If The Ghost Piece Is Too Close To The Active Piece, Don't Place It
+                return;
+            }
+
+            // Place The Ghost Piece In Its Position
+            ghostShape = &activeShape();
+            ghostRow = landing;
+            ghostCol = activePieceCol;
+            hasGhost = true;
+            for (unsigned int cell = 0; cell < PIECE_CELLS; ++cell) {
+                setCell(ghostRow + ghostShape->cellRow[cell], ghostCol + ghostShape->cellCol[cell], GHOST_CELL);
+            }
+
+        }
+
+
+        /*
+
+            Desc: Shows A Suggested Placement Of The Active Piece As Its Ghost Until
+            The Piece Locks Or The Hint Is Cleared.
+
+            Preconditions:
+                1.) (rotation, row, col) Is A Placement Of The Active Piece That Fits On The Board.
+
+            Postconditions:
+                1.) The Ghost Is Redrawn At The Hint, Unless There's No Active Piece.
+
+        */
+        void setHint(unsigned int rotation, unsigned int row, unsigned int col)
+        {
+
+            if (!hasActivePiece) return;
+
+            hasHint = true;
+            hintRotation = rotation;
+            hintRow = row;
+            hintCol = col;
+            ghostPiece();
+
+        }
+
+
+        /*
+
+            Desc: Goes Back To Showing Where The Active Piece Would Land.
+
+            Preconditions:
+                1.) None
+
+            Postconditions:
+                1.) Any Hint Is Dropped And The Ghost Is Redrawn At The Landing Position.
+
+        */
+        void clearHint()
+        {
+
+            if (!hasHint) return;
+
+            hasHint = false;
+            ghostPiece();
+
+        }
+
+
+        // Getters
+        BlockState getCellState(unsigned int row, unsigned int col) const { return cellState(cells[row * Cols + col]); }
+        Cell getCell(unsigned int row, unsigned int col) const { return cells[row * Cols + col]; }
+        const std::array<Cell, Rows * Cols>& getCells() const { return cells; }
+        const Bits& getOccupancy() const { return occupancy; }
+        std::uint64_t getHash() const { return hash; }
+        unsigned int getNextPiece() const { return nextPiece; }
+        unsigned int getActivePiece() const { return activePiece; }
+        unsigned int getActiveRotation() const { return activeRotation; }
+        unsigned int getActiveRow() const { return activePieceRow; }
+        unsigned int getActiveCol() const { return activePieceCol; }
+        std::uint64_t getSeed() const { return stream.getSeed(); }
+        unsigned int getScore() const { return score; }
+        unsigned int getLinesCleared() const { return linesCleared; }
+        unsigned int getLevel() const { return level; }
+        unsigned int getPiecesLocked() const { return piecesLocked; }
+        bool isPieceActive() const { return hasActivePiece; }
+        bool isHintShown() const { return hasHint; }
+        static constexpr unsigned int getRows() { return Rows; }
+        static constexpr unsigned int getCols() { return Cols; }
+        unsigned int getSurfaceRow(unsigned int col) const { return surfaceRow[col]; }
+        bool isGameOver() const { return gameOver; }
+
+};
+
+
+// Board Sizes Built Once In tetris_core (gamecore.cpp)
+extern template class GameCore<CONFIG::BOARD_ROWS, CONFIG::BOARD_COLS>;
+extern template class GameCore<CONFIG::TALL_BOARD_ROWS, CONFIG::BOARD_COLS>;
+extern template class GameCore<CONFIG::BOARD_ROWS, CONFIG::WIDE_BOARD_COLS>;
@@ -0,0 +1,65 @@
+#include "gamerecord.h"
+#include <fstream>
+
+
+/*
+
+    Desc: Writes A Record As Two Lines: Its Seed, Then Its Inputs.
+
+    Preconditions:
+        1.) None
+
+    Postconditions:
+        1.) Returns False If path Couldn't Be Written.
+
+*/
+bool saveGameRecord(const std::string& path, const GameRecord& record)
+{
+
+    std::ofstream file(path);
+    if (!file.is_open()) return false;
+
+    file << record.seed << "\n" << record.inputs << "\n";
+    return static_cast<bool>(file);
+
+}
+
+
+/*
+
+    Desc: Reads A Record Written By saveGameRecord.
+
+    Preconditions:
+        1.) None
+
+    Postconditions:
+        1.) Returns False, Leaving record Partly Read, If path Is Missing Or Malformed.
+
+*/
+bool loadGameRecord(const std::string& path, GameRecord& record)
+{
+
+    std::ifstream file(path);
+    if (!file.is_open()) return false;
+
+    if (!(file >> record.seed)) return false;
+    file >> std::ws;
+    std::getline(file, record.inputs);
+
+    for (char input : record.inputs) {
+        switch (input)
+        {
+            case MOVE_INPUT::LEFT:
+            case MOVE_INPUT::RIGHT:
+            case MOVE_INPUT::ROTATE:
+            case MOVE_INPUT::SOFT_DROP:
+            case MOVE_INPUT::HARD_DROP:
+            case RECORD_INPUT::GRAVITY:
+                break;
+            default:
+                return false;
+        }
+    }
+    return true;
+
+}
@@ -0,0 +1,97 @@
+#pragma once
+
+
+#include <cstdint>
+#include <string>
+#include "movegen.h"
+#include "config.h"
+
+
+
+// Recorded Inputs Beyond The MOVE_INPUT Keys
+namespace RECORD_INPUT
+{
+    constexpr char GRAVITY = 'G';   // The Game Stepping On Its Own Timer
+}
+
+
+/*
+
+    Desc: Everything Needed To Replay A Game Exactly: The Seed Its Pieces Were
+    Dealt From And Every Call Made Into It, In Order. Keys Are Stored As MOVE_INPUT
+    Characters And Timer Steps As RECORD_INPUT::GRAVITY, So A Game Of Thousands Of
+    Pieces Is A Single Short Line Of Text.
+
+*/
+struct GameRecord
+{
+
+    std::uint64_t seed = 0;
+    std::string inputs;
+
+};
+
+
+bool saveGameRecord(const std::string& path, const GameRecord& record);
+bool loadGameRecord(const std::string& path, GameRecord& record);
+
+
+/*
+
+    Desc: Stands In For A Game (A GameCore Or Our Board) Anywhere Its Input
+    Functions Are Called, Like Bot::playPiece, Forwarding Every Call And Appending
+    It To A GameRecord.
+
+*/
+template <typename Game>
+class RecordingGame
+{
+
+    private:
+
+        Game& game;
+        GameRecord& record;
+
+
+    public:
+
+        RecordingGame(Game& newGame, GameRecord& newRecord)
+            : game(newGame), record(newRecord)
+        {
+        }
+
+
+        // The Game's Input Functions, Each Recorded Then Forwarded
+        void shiftActivePiece(char direction)
+        {
+
+            record.inputs.push_back(direction);     // MOVE_INPUT Shares The Direction Letters
+            game.shiftActivePiece(direction);
+
+        }
+
+        void rotateActivePiece()
+        {
+
+            record.inputs.push_back(MOVE_INPUT::ROTATE);
+            game.rotateActivePiece();
+
+        }
+
+        void step()
+        {
+
+            record.inputs.push_back(MOVE_INPUT::SOFT_DROP);
+            game.step();
+
+        }
+
+        // Only Redraws, So Isn't Part Of The Record
+        void ghostPiece()
+        {
+
+            game.ghostPiece();
+
+        }
+
+};
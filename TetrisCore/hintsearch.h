@@ -0,0 +1,427 @@
+#pragma once
+
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <limits>
+#include <mutex>
+#include <thread>
+#include "evaluator.h"
+#include "movegen.h"
+#include "openingbook.h"
+#include "pieces.h"
+#include "config.h"
+
+
+
+/*
+
+    Desc: Searches For The Best Placement Of The Active Piece On A Thread Of Its
+    Own While The Player Thinks, So The Game Loop Never Waits On It. The Search Is
+    Anytime: It Deepens In Stages (The Active Piece Alone, Then With The Preview,
+    Then Past The Preview Against Every Possible Piece), Trying Each Stage's
+    Placements Best-First By The Last Stage's Scores, And Publishes Every
+    Improvement As A Single Atomic Word The Render Thread Reads Without Locking.
+    Starting A New Search Or Cancelling Bumps A Generation Counter; The Worker
+    Checks It Between Placements, Abandons Stale Work Right Away, And Readers
+    Ignore Hints From Any Generation But The Current One. Positions In The
+    Opening Book, If One Is Set, Are Answered From It Without Searching. Every
+    Buffer Is Sized Up Front, So Searching Never Touches The Heap.
+
+*/
+template <unsigned int Rows, unsigned int Cols>
+class HintSearch
+{
+
+    public:
+
+        using Bits = BitBoard<Rows, Cols>;
+        using Generator = MoveGenerator<Rows, Cols>;
+
+        // Active Piece Alone, With The Preview, And Past The Preview
+        static constexpr unsigned int STAGE_COUNT = 3;
+
+
+    private:
+
+        // What A Search Is Asked To Solve
+        struct Job
+        {
+
+            Bits board;
+            unsigned int piece, nextPiece;
+            unsigned int rotation, row, col;
+            const OpeningBook* book;
+
+        };
+
+        EvalWeights weights;
+
+        // Handing Jobs To The Worker (Held Only While Copying One)
+        std::mutex jobLock;
+        std::condition_variable jobReady;
+        Job job;
+        const OpeningBook* book;
+        std::uint32_t jobGeneration, takenGeneration;
+        bool stopping;
+
+        // Bumped By start() & cancel(); A Search Of Any Other Generation Is Stale
+        std::atomic<std::uint32_t> generation;
+
+        // Best Hint So Far: Generation << 32 | Stage << 24 | Rotation << 16 | Row << 8 | Col (Stage 0 Means None)
+        std::atomic<std::uint64_t> published;
+
+        // The Worker's Own Search State
+        Generator rootGenerator, childGenerator, leafGenerator;
+        std::array<float, Generator::STATE_COUNT> rootScores, childScores;
+        std::array<unsigned int, Generator::STATE_COUNT> order, childOrder;
+
+        std::thread worker;
+
+
+        bool isStale(std::uint32_t searchGeneration) const
+        {
+            return generation.load(std::memory_order_relaxed) != searchGeneration;
+        }
+
+
+        /*
+
+            Desc: Makes A Placement Of The Current Search The Hint Readers See.
+
+            Preconditions:
+                1.) stage Is Between 1 And STAGE_COUNT.
+
+            Postconditions:
+                1.) this->published Holds The Placement, Tagged With searchGeneration & stage.
+
+        */
+        void publish(std::uint32_t searchGeneration, unsigned int stage, const Placement& placement)
+        {
+
+            published.store(std::uint64_t(searchGeneration) << 32 | std::uint64_t(stage) << 24 |
+                std::uint64_t(placement.rotation) << 16 | std::uint64_t(placement.row) << 8 | placement.col, std::memory_order_release);
+
+        }
+
+
+        /*
+
+            Desc: Finds The Best Score Of Any Placement Of piece On board.
+
+            Preconditions:
+                1.) None
+
+            Postconditions:
+                1.) Returns The Best evaluateBoard() With lines Added To Each Placement's Own, Or CONFIG::HINT_TOP_OUT_SCORE If piece Can't Be Placed.
+
+        */
+        float bestLeaf(const Bits& board, unsigned int piece, unsigned int lines)
+        {
+
+            const unsigned int placements = leafGenerator.generate(board, piece);
+            if (!placements) return CONFIG::HINT_TOP_OUT_SCORE;
+
+            float best = std::numeric_limits<float>::lowest();
+            for (unsigned int i = 0; i < placements; ++i) {
+                Bits leaf = board;
+                const unsigned int leafLines = applyPlacement(leaf, piece, leafGenerator.getPlacement(i));
+                best = std::max(best, evaluateBoard(leaf, lines + leafLines, weights));
+            }
+            return best;
+
+        }
+
+
+        /*
+
+            Desc: Scores One Placement Of The Active Piece At A Stage Past The First.
+
+            Preconditions:
+                1.) root Is Within this->rootGenerator's Placements For job.
+
+            Postconditions:
+                1.) Returns The Score, Or The Lowest Float If The Search Went Stale Partway.
+
+        */
+        float scoreRoot(const Job& search, unsigned int root, unsigned int stage, std::uint32_t searchGeneration)
+        {
+
+            Bits board = search.board;
+            const unsigned int lines = applyPlacement(board, search.piece, rootGenerator.getPlacement(root));
+
+            if (stage == 2) return bestLeaf(board, search.nextPiece, lines);
+
+            // Rank Every Follow-Up With The Preview, Then Look Past The Best Few Against Each Possible Piece
+            const unsigned int children = childGenerator.generate(board, search.nextPiece);
+            if (!children) return CONFIG::HINT_TOP_OUT_SCORE;
+
+            for (unsigned int i = 0; i < children; ++i) {
+                Bits child = board;
+                const unsigned int childLines = applyPlacement(child, search.nextPiece, childGenerator.getPlacement(i));
+                childScores[i] = evaluateBoard(child, lines + childLines, weights);
+                childOrder[i] = i;
+            }
+
+            const unsigned int kept = std::min(children, CONFIG::HINT_STAGE_WIDTH);
+            std::partial_sort(childOrder.begin(), childOrder.begin() + kept, childOrder.begin() + children,
+                [this](unsigned int a, unsigned int b) { return childScores[a] > childScores[b]; });
+
+            float best = std::numeric_limits<float>::lowest();
+            for (unsigned int i = 0; i < kept; ++i) {
+                if (isStale(searchGeneration)) return std::numeric_limits<float>::lowest();
+
+                Bits child = board;
+                const unsigned int childLines = applyPlacement(child, search.nextPiece, childGenerator.getPlacement(childOrder[i]));
+
+                float total = 0.0f;
+                for (unsigned int piece = 0; piece < PIECE_COUNT; ++piece) {
+                    total += bestLeaf(child, piece, lines + childLines);
+                }
+                best = std::max(best, total / PIECE_COUNT);
+            }
+            return best;
+
+        }
+
+
+        /*
+
+            Desc: Runs Every Stage Of A Search, Publishing As It Improves.
+
+            Preconditions:
+                1.) Called On The Worker Thread.
+
+            Postconditions:
+                1.) Returns Once Every Stage Is Done Or The Search Went Stale.
+
+        */
+        void search(const Job& search, std::uint32_t searchGeneration)
+        {
+
+            const unsigned int placements = rootGenerator.generate(search.board, search.piece, search.rotation, search.row, search.col);
+            if (!placements) return;
+
+            // A Book Placement Is As Good As Every Stage's Answer, So Nothing's Left To Search
+            const int booked = search.book ? search.book->find(search.board, search.piece, rootGenerator) : -1;
+            if (booked >= 0)
+            {
+                publish(searchGeneration, STAGE_COUNT, rootGenerator.getPlacement(booked));
+                return;
+            }
+
+            // Stage 1: Each Placement On Its Own
+            for (unsigned int i = 0; i < placements; ++i) {
+                Bits board = search.board;
+                const unsigned int lines = applyPlacement(board, search.piece, rootGenerator.getPlacement(i));
+                rootScores[i] = evaluateBoard(board, lines, weights);
+                order[i] = i;
+            }
+
+            for (unsigned int stage = 1; stage <= STAGE_COUNT; ++stage) {
+
+                // Last Stage's Best First, So The Running Best Is Worth Showing Straight Away
+                std::sort(order.begin(), order.begin() + placements, [this](unsigned int a, unsigned int b) { return rootScores[a] > rootScores[b]; });
+
+                if (stage > 1)
+                {
+                    float best = std::numeric_limits<float>::lowest();
+                    for (unsigned int i = 0; i < placements; ++i) {
+                        const unsigned int root = order[i];
+                        const float score = scoreRoot(search, root, stage, searchGeneration);
+                        if (isStale(searchGeneration)) return;
+
+                        rootScores[root] = score;
+                        if (score > best)
+                        {
+                            best = score;
+                            publish(searchGeneration, stage, rootGenerator.getPlacement(root));
+                        }
+                    }
+                }
+                else
+                {
+                    publish(searchGeneration, stage, rootGenerator.getPlacement(order[0]));
+                }
+            }
+
+        }
+
+
+        /*
+
+            Desc: The Worker Thread: Waits For Jobs And Searches Them Until Stopped.
+
+            Preconditions:
+                1.) None
+
+            Postconditions:
+                1.) Returns Once this->stopping Is Set.
+
+        */
+        void workerLoop()
+        {
+
+            Job local;
+            for (;;) {
+                std::uint32_t searchGeneration;
+                {
+                    std::unique_lock<std::mutex> lock(jobLock);
+                    jobReady.wait(lock, [this] { return stopping || jobGeneration != takenGeneration; });
+                    if (stopping) return;
+
+                    local = job;
+                    searchGeneration = takenGeneration = jobGeneration;
+                }
+
+                if (!isStale(searchGeneration)) search(local, searchGeneration);
+            }
+
+        }
+
+
+    public:
+
+        /*
+
+            Desc: Starts The Worker Thread, Idle Until The First start().
+
+            Preconditions:
+                1.) None
+
+            Postconditions:
+                1.) There's No Hint Until A Search Publishes One.
+
+        */
+        explicit HintSearch(const EvalWeights& newWeights = DEFAULT_WEIGHTS)
+            : weights(newWeights), job{}, book(nullptr), jobGeneration(0), takenGeneration(0), stopping(false),
+            generation(0), published(0), rootScores{}, childScores{}, order{}, childOrder{}
+        {
+
+            worker = std::thread(&HintSearch::workerLoop, this);
+
+        }
+
+
+        /*
+
+            Desc: Stops And Joins The Worker, Abandoning Any Search.
+
+            Preconditions:
+                1.) None
+
+            Postconditions:
+                1.) The Worker Thread Has Exited.
+
+        */
+        ~HintSearch()
+        {
+
+            {
+                std::lock_guard<std::mutex> guard(jobLock);
+                stopping = true;
+            }
+            generation.fetch_add(1, std::memory_order_relaxed);
+            jobReady.notify_one();
+            worker.join();
+
+        }
+
+        HintSearch(const HintSearch&) = delete;
+        HintSearch& operator=(const HintSearch&) = delete;
+
+
+        /*
+
+            Desc: Starts Searching For piece (Followed By nextPiece) From (rotation,
+            row, col) On board, Dropping Whatever Was Being Searched Before.
+
+            Preconditions:
+                1.) None
+
+            Postconditions:
+                1.) Hints Of Earlier Searches Are No Longer Returned; The Worker Picks This One Up As Soon As It's Free.
+
+        */
+        void start(const Bits& board, unsigned int piece, unsigned int nextPiece, unsigned int rotation, unsigned int row, unsigned int col)
+        {
+
+            {
+                std::lock_guard<std::mutex> guard(jobLock);
+                job = { board, piece, nextPiece, rotation, row, col, book };
+                jobGeneration = generation.fetch_add(1, std::memory_order_relaxed) + 1;
+            }
+            jobReady.notify_one();
+
+        }
+
+
+        /*
+
+            Desc: Has Searches Started From Now On Look In newBook First.
+
+            Preconditions:
+                1.) newBook Outlives Every Search Started With It (Or Is Null, Turning The Book Off).
+
+            Postconditions:
+                1.) A Position In The Book Is Answered At Once, At The Last Stage.
+
+        */
+        void setBook(const OpeningBook* newBook)
+        {
+
+            std::lock_guard<std::mutex> guard(jobLock);
+            book = newBook;
+
+        }
+
+
+        /*
+
+            Desc: Abandons The Current Search Without Waiting For The Worker.
+
+            Preconditions:
+                1.) None
+
+            Postconditions:
+                1.) getHint Returns False Until The Next start() Publishes.
+
+        */
+        void cancel()
+        {
+
+            generation.fetch_add(1, std::memory_order_relaxed);
+
+        }
+
+
+        /*
+
+            Desc: Reads The Best Hint Of The Current Search So Far, Without Locking.
+
+            Preconditions:
+                1.) None
+
+            Postconditions:
+                1.) Returns False If The Current Search Hasn't Published Yet (Or Was Cancelled).
+                2.) Otherwise placement Is The Hint And stage Is How Deep It Was Searched.
+
+        */
+        bool getHint(Placement& placement, unsigned int& stage) const
+        {
+
+            const std::uint64_t packed = published.load(std::memory_order_acquire);
+            stage = static_cast<unsigned int>(packed >> 24) & 0xFFu;
+            if (!stage || static_cast<std::uint32_t>(packed >> 32) != generation.load(std::memory_order_relaxed)) return false;
+
+            placement.rotation = static_cast<std::uint8_t>(packed >> 16);
+            placement.row = static_cast<std::uint8_t>(packed >> 8);
+            placement.col = static_cast<std::uint8_t>(packed);
+            return true;
+
+        }
+
+};
@@ -0,0 +1,130 @@
+#include "mappedfile.h"
+
+#ifdef _WIN32
+#define NOMINMAX
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+
+#ifdef _WIN32
+MappedFile::MappedFile()
+    : data(nullptr), size(0), fileHandle(INVALID_HANDLE_VALUE), mappingHandle(nullptr)
+{
+}
+#else
+MappedFile::MappedFile()
+    : data(nullptr), size(0)
+{
+}
+#endif
+
+
+MappedFile::~MappedFile()
+{
+
+    close();
+
+}
+
+
+/*
+
+    Desc: Maps The File At path, Dropping Any File Mapped Before.
+
+    Preconditions:
+        1.) None
+
+    Postconditions:
+        1.) Returns False, Leaving Nothing Mapped, If The File Can't Be Opened, Is Empty, Or Can't Be Mapped.
+        2.) Otherwise getData() Points At Its getSize() Bytes.
+
+*/
+bool MappedFile::open(const std::string& path)
+{
+
+    close();
+
+#ifdef _WIN32
+    HANDLE file = CreateFileA(path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+    if (file == INVALID_HANDLE_VALUE) return false;
+
+    LARGE_INTEGER length;
+    if (!GetFileSizeEx(file, &length) || length.QuadPart <= 0)
+    {
+        CloseHandle(file);
+        return false;
+    }
+
+    HANDLE mapping = CreateFileMappingA(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+    void* view = mapping ? MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0) : nullptr;
+    if (!view)
+    {
+        if (mapping) CloseHandle(mapping);
+        CloseHandle(file);
+        return false;
+    }
+
+    fileHandle = file;
+    mappingHandle = mapping;
+    data = static_cast<const unsigned char*>(view);
+    size = static_cast<std::size_t>(length.QuadPart);
+#else
+    const int file = ::open(path.c_str(), O_RDONLY);
+    if (file < 0) return false;
+
+    struct stat info;
+    if (fstat(file, &info) != 0 || info.st_size <= 0)
+    {
+        ::close(file);
+        return false;
+    }
+
+    // The Mapping Outlives The Descriptor
+    void* view = mmap(nullptr, static_cast<std::size_t>(info.st_size), PROT_READ, MAP_SHARED, file, 0);
+    ::close(file);
+    if (view == MAP_FAILED) return false;
+
+    data = static_cast<const unsigned char*>(view);
+    size = static_cast<std::size_t>(info.st_size);
+#endif
+
+    return true;
+
+}
+
+
+/*
+
+    Desc: Unmaps The File, If One Is Mapped.
+
+    Preconditions:
+        1.) Nothing Still Points Into getData().
+
+    Postconditions:
+        1.) Nothing Is Mapped.
+
+*/
+void MappedFile::close()
+{
+
+    if (!data) return;
+
+#ifdef _WIN32
+    UnmapViewOfFile(data);
+    CloseHandle(mappingHandle);
+    CloseHandle(fileHandle);
+    fileHandle = INVALID_HANDLE_VALUE;
+    mappingHandle = nullptr;
+#else
+    munmap(const_cast<unsigned char*>(data), size);
+#endif
+
+    data = nullptr;
+    size = 0;
+
+}
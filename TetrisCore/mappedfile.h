@@ -0,0 +1,48 @@
+#pragma once
+
+
+#include <cstddef>
+#include <string>
+
+
+
+/*
+
+    Desc: A Whole File Mapped Read-Only Into Memory, So Large Tables Built Offline
+    (Network Weights, Opening Books) Are Used Straight From The Page Cache With No
+    Parse Or Copy At Startup; Pages Are Only Read From Disk When First Touched. The
+    Mapping Lasts Until close() Or Destruction.
+
+*/
+class MappedFile
+{
+
+    private:
+
+        const unsigned char* data;
+        std::size_t size;
+
+#ifdef _WIN32
+        void* fileHandle;
+        void* mappingHandle;
+#endif
+
+
+    public:
+
+        MappedFile();
+        ~MappedFile();
+
+        MappedFile(const MappedFile&) = delete;
+        MappedFile& operator=(const MappedFile&) = delete;
+
+        bool open(const std::string& path);
+        void close();
+
+
+        // Getters
+        const unsigned char* getData() const { return data; }
+        std::size_t getSize() const { return size; }
+        bool isOpen() const { return data != nullptr; }
+
+};
@@ -0,0 +1,581 @@
+#pragma once
+
+
+#include <array>
+#include <cstdint>
+#include "bitboard.h"
+#include "gamecore.h"
+#include "pieces.h"
+
+
+
+/*
+
+    Desc: Inputs Making Up A Path To A Placement. These Are The Same Characters
+    GameCore::shiftActivePiece Takes, Plus A Clockwise Turn (GameCore::rotateActivePiece)
+    And A Soft Drop Of One Row (A GameCore::step While The Piece Can Still Fall).
+
+*/
+namespace MOVE_INPUT
+{
+    constexpr char LEFT = 'L';
+    constexpr char RIGHT = 'R';
+    constexpr char ROTATE = 'C';
+    constexpr char SOFT_DROP = 'S';
+    constexpr char HARD_DROP = 'D';
+}
+
+
+/*
+
+    Desc: Where A Piece Can Come To Rest; A Placement Is Locked By One More
+    GameCore::step Once Its Path Has Been Played. rotation Is One The Piece Can
+    Actually Reach, So It's Also Where The Path Leaves The Piece Turned.
+
+*/
+struct Placement
+{
+
+    std::uint8_t rotation, row, col;
+
+};
+
+
+/*
+
+    Desc: Rotation States Whose Shape Is Identical To An Earlier Rotation State
+    (O, And The 180 Degree Turns Of I, S, And Z) Map Back To That Earlier State,
+    So Placements Covering The Same Cells Are Only Reported Once.
+
+    Preconditions:
+        1.) piece & rotation Are Valid Indices Into The PieceTable.
+
+    Postconditions:
+        1.) Returns The Lowest Rotation With The Same Rows As rotation.
+
+*/
+constexpr unsigned int canonicalRotation(unsigned int piece, unsigned int rotation)
+{
+
+    const PieceRotation& shape = PIECE_TABLE.get(piece, rotation);
+
+    for (unsigned int earlier = 0; earlier < rotation; ++earlier) {
+        const PieceRotation& other = PIECE_TABLE.get(piece, earlier);
+        if (other.height != shape.height || other.width != shape.width) continue;
+
+        bool same = true;
+        for (unsigned int i = 0; i < shape.height; ++i) {
+            if (other.rows[i] != shape.rows[i]) same = false;
+        }
+        if (same) return earlier;
+    }
+
+    return rotation;
+
+}
+
+static_assert(canonicalRotation(1, 3) == 0 && canonicalRotation(0, 2) == 0 && canonicalRotation(2, 2) == 2, "Only Symmetric Turns Should Fold Together");
+
+
+/*
+
+    Desc: Finds Every Distinct Place A Piece Can Come To Rest From A Start Position
+    Through Shifts, Clockwise Turns, And Drops, Along With An Input Path To Each.
+    The Board Is First Turned Into A Table Of Row Masks Saying Which Columns Each
+    Rotation Fits In At Each Row; Since A Piece Never Moves Up, Reachable States Can
+    Then Be Flood Filled A Row At A Time, Spreading Sideways And Through Turns With
+    Whole-Row Bit Operations Before Dropping Into The Next Row. The Visited States
+    Are Kept As Row Masks As Well, Paths Are Rebuilt From Them Only When Asked For,
+    And Every Buffer Is A Fixed Array, So A Generator Never Touches The Heap And Is
+    Meant To Be Kept Around And Reused.
+
+*/
+template <unsigned int Rows, unsigned int Cols>
+class MoveGenerator
+{
+
+    public:
+
+        using Bits = BitBoard<Rows, Cols>;
+        using RowMask = typename Bits::RowMask;
+
+        // One State Per Rotation, Row, And Column The Piece's Top-Left Can Sit At; A
+        // Path Never Repeats A State, So This Also Bounds How Long A Path Can Be
+        static constexpr unsigned int STATE_COUNT = ROTATION_COUNT * Rows * Cols;
+        static constexpr unsigned int MAX_PATH_LENGTH = STATE_COUNT;
+
+        // States Within A Single Row
+        static constexpr unsigned int ROW_STATES = ROTATION_COUNT * Cols;
+
+
+    private:
+
+        // fits[rotation][row] Bit N Set If The Piece Fits With Its Top-Left At (row, N); Row Rows Is Always Empty
+        std::array<std::array<RowMask, Rows + 1>, ROTATION_COUNT> fits;
+
+        // reached[rotation][row] Bit N Set If The Piece Can Get To (row, N) In That Rotation
+        std::array<std::array<RowMask, Rows>, ROTATION_COUNT> reached;
+
+        // Placements Already Reported, By Canonical Rotation
+        std::array<std::array<RowMask, Rows>, ROTATION_COUNT> rested;
+
+        // Results
+        std::array<Placement, STATE_COUNT> placements;
+        unsigned int placementCount;
+        unsigned int piece;
+        unsigned int startRotation, startRow, startCol;
+
+
+        bool fitsAt(unsigned int rotation, unsigned int row, unsigned int col) const
+        {
+            return (fits[rotation][row] >> col) & 1u;
+        }
+
+
+        bool restsAt(unsigned int rotation, unsigned int row, unsigned int col) const
+        {
+            return !fitsAt(rotation, row + 1, col);
+        }
+
+
+        /*
+
+            Desc: Fills this->fits For Every Rotation Of this->piece On board. Shifting
+            A Row Right By A Cell's Column Lines Up Every Column Where That Cell Would
+            Land On Something, So OR-ing That Over The Piece's Four Cells Gives All
+            Blocked Columns Of A Row In One Go.
+
+            Preconditions:
+                1.) this->piece Is A Valid Index Into The PieceTable.
+
+            Postconditions:
+                1.) this->fits Holds Where Each Rotation Of this->piece Fits On board.
+
+        */
+        void buildFits(const Bits& board)
+        {
+
+            for (unsigned int rotation = 0; rotation < ROTATION_COUNT; ++rotation) {
+                const PieceRotation& shape = PIECE_TABLE_FOR<Cols>.get(piece, rotation);
+
+                // Columns The Shape's Left Edge Can Take Without Hanging Off The Right
+                const RowMask inside = static_cast<RowMask>(Bits::FULL_ROW >> (shape.width - 1));
+
+                for (unsigned int row = 0; row + shape.height <= Rows; ++row) {
+                    std::uint32_t blocked = 0;
+                    for (unsigned int cell = 0; cell < PIECE_CELLS; ++cell) {
+                        blocked |= static_cast<std::uint32_t>(board.getRow(row + shape.cellRow[cell])) >> shape.cellCol[cell];
+                    }
+                    fits[rotation][row] = static_cast<RowMask>(~blocked & inside);
+                }
+
+                for (unsigned int row = Rows + 1 - shape.height; row <= Rows; ++row) {
+                    fits[rotation][row] = 0;
+                }
+            }
+
+        }
+
+
+        /*
+
+            Desc: Fills this->reached One Row At A Time From The Start Position. Each Row
+            Starts From Whatever Could Soft Drop Into It From The Row Above, Then Spreads
+            Sideways Through Runs Of Fitting Columns And Across Turns Until Nothing New
+            Turns Up.
+
+            Preconditions:
+                1.) this->fits Is Built And The Piece Fits At The Start Position.
+
+            Postconditions:
+                1.) this->reached Holds Every State Reachable From The Start Position.
+
+        */
+        void floodFill()
+        {
+
+            for (unsigned int rotation = 0; rotation < ROTATION_COUNT; ++rotation) {
+                reached[rotation].fill(0);
+            }
+            reached[startRotation][startRow] = static_cast<RowMask>(RowMask(1) << startCol);
+
+            for (unsigned int row = startRow; row < Rows; ++row) {
+
+                std::array<RowMask, ROTATION_COUNT> current;
+                for (unsigned int rotation = 0; rotation < ROTATION_COUNT; ++rotation) {
+                    current[rotation] = (row == startRow) ? reached[rotation][row] : static_cast<RowMask>(reached[rotation][row - 1] & fits[rotation][row]);
+                }
+
+                bool turnedIntoNew = true;
+                while (turnedIntoNew) {
+                    turnedIntoNew = false;
+
+                    for (unsigned int rotation = 0; rotation < ROTATION_COUNT; ++rotation) {
+                        const RowMask open = fits[rotation][row];
+
+                        RowMask spread = current[rotation];
+                        for (RowMask grown; (grown = static_cast<RowMask>(spread | (((spread << 1) | (spread >> 1)) & open))) != spread; ) {
+                            spread = grown;
+                        }
+                        current[rotation] = spread;
+
+                        const unsigned int turned = (rotation + 1) % ROTATION_COUNT;
+                        const RowMask turnedMask = static_cast<RowMask>(current[turned] | (spread & fits[turned][row]));
+                        if (turnedMask != current[turned])
+                        {
+                            current[turned] = turnedMask;
+                            turnedIntoNew = true;
+                        }
+                    }
+                }
+
+                bool any = false;
+                for (unsigned int rotation = 0; rotation < ROTATION_COUNT; ++rotation) {
+                    reached[rotation][row] = current[rotation];
+                    any = any || current[rotation];
+                }
+
+                // Nothing Made It Into This Row, So Nothing Can Get Any Lower
+                if (!any) break;
+            }
+
+        }
+
+
+        /*
+
+            Desc: Reports Every Reached State The Piece Would Rest In, Folding Together
+            Rotations With Identical Shapes.
+
+            Preconditions:
+                1.) this->reached Is Filled.
+
+            Postconditions:
+                1.) this->placements Holds Each Distinct Resting Place Once, Top Row First.
+
+        */
+        void collectPlacements()
+        {
+
+            for (unsigned int rotation = 0; rotation < ROTATION_COUNT; ++rotation) {
+                rested[rotation].fill(0);
+            }
+
+            for (unsigned int row = startRow; row < Rows; ++row) {
+                for (unsigned int rotation = 0; rotation < ROTATION_COUNT; ++rotation) {
+
+                    const unsigned int canonical = canonicalRotation(piece, rotation);
+                    const RowMask resting = static_cast<RowMask>(reached[rotation][row] & ~fits[rotation][row + 1] & ~rested[canonical][row]);
+                    if (!resting) continue;
+
+                    rested[canonical][row] = static_cast<RowMask>(rested[canonical][row] | resting);
+                    for (unsigned int col = 0; col < Cols; ++col) {
+                        if ((resting >> col) & 1u)
+                        {
+                            Placement& placement = placements[placementCount++];
+                            placement.rotation = static_cast<std::uint8_t>(rotation);
+                            placement.row = static_cast<std::uint8_t>(row);
+                            placement.col = static_cast<std::uint8_t>(col);
+                        }
+                    }
+
+                }
+            }
+
+        }
+
+
+        /*
+
+            Desc: Searches Within A Single Row For The Fewest Shifts & Turns Reaching
+            (rotation, col) From Anywhere The Piece Could Have Entered That Row (The
+            Start Position In The Start Row, Otherwise Any State Reached Right Above).
+
+            Preconditions:
+                1.) (rotation, row, col) Is Reached.
+
+            Postconditions:
+                1.) The Moves Are Appended To reversed Last Move First.
+                2.) entryRotation & entryCol Hold Where The Piece Entered The Row.
+
+        */
+        void walkRow(unsigned int rotation, unsigned int row, unsigned int col, char* reversed, unsigned int& length, unsigned int& entryRotation, unsigned int& entryCol) const
+        {
+
+            std::array<std::uint8_t, ROW_STATES> queue, parent;
+            std::array<char, ROW_STATES> move;
+            std::array<RowMask, ROTATION_COUNT> seen{};
+
+            unsigned int head = 0, tail = 0;
+            for (unsigned int r = 0; r < ROTATION_COUNT; ++r) {
+                RowMask entries = (row == startRow) ? static_cast<RowMask>(r == startRotation ? RowMask(1) << startCol : 0)
+                                                    : static_cast<RowMask>(reached[r][row] & reached[r][row - 1]);
+                seen[r] = entries;
+                for (unsigned int c = 0; c < Cols; ++c) {
+                    if ((entries >> c) & 1u)
+                    {
+                        const unsigned int state = r * Cols + c;
+                        parent[state] = static_cast<std::uint8_t>(state);
+                        queue[tail++] = static_cast<std::uint8_t>(state);
+                    }
+                }
+            }
+
+            const unsigned int target = rotation * Cols + col;
+            auto enqueue = [&](unsigned int from, unsigned int r, unsigned int c, char input) {
+                if (!((reached[r][row] >> c) & 1u) || ((seen[r] >> c) & 1u)) return;
+                seen[r] = static_cast<RowMask>(seen[r] | (RowMask(1) << c));
+                const unsigned int state = r * Cols + c;
+                parent[state] = static_cast<std::uint8_t>(from);
+                move[state] = input;
+                queue[tail++] = static_cast<std::uint8_t>(state);
+            };
+
+            while (head < tail && !((seen[rotation] >> col) & 1u)) {
+                const unsigned int state = queue[head++];
+                const unsigned int r = state / Cols, c = state % Cols;
+
+                if (c > 0) enqueue(state, r, c - 1, MOVE_INPUT::LEFT);
+                if (c + 1 < Cols) enqueue(state, r, c + 1, MOVE_INPUT::RIGHT);
+                enqueue(state, (r + 1) % ROTATION_COUNT, c, MOVE_INPUT::ROTATE);
+            }
+
+            unsigned int state = target;
+            while (parent[state] != state) {
+                reversed[length++] = move[state];
+                state = parent[state];
+            }
+
+            entryRotation = state / Cols;
+            entryCol = state % Cols;
+
+        }
+
+
+    public:
+
+        /*
+
+            Desc: Creates A Generator With No Results.
+
+            Preconditions:
+                1.) None
+
+            Postconditions:
+                1.) getPlacementCount() Is 0.
+
+        */
+        MoveGenerator()
+            : fits{}, reached{}, rested{}, placementCount(0), piece(0), startRotation(0), startRow(0), startCol(0)
+        {
+        }
+
+
+        /*
+
+            Desc: Finds Every Placement Of newPiece Reachable From (rotation, row, col)
+            On board, Replacing The Results Of Any Previous Search.
+
+            Preconditions:
+                1.) newPiece & rotation Are Valid Indices Into The PieceTable.
+                2.) row & col Are Within The Board.
+
+            Postconditions:
+                1.) Returns How Many Distinct Placements Were Found (0 If The Piece Doesn't Fit At Its Start).
+                2.) Placements Covering The Same Cells Are Only Reported Once, Top Row First.
+
+        */
+        unsigned int generate(const Bits& board, unsigned int newPiece, unsigned int rotation, unsigned int row, unsigned int col)
+        {
+
+            piece = newPiece;
+            startRotation = rotation;
+            startRow = row;
+            startCol = col;
+            placementCount = 0;
+
+            buildFits(board);
+            if (!fitsAt(rotation, row, col))
+            {
+                for (unsigned int r = 0; r < ROTATION_COUNT; ++r) {
+                    reached[r].fill(0);
+                }
+                return 0;
+            }
+
+            floodFill();
+            collectPlacements();
+            return placementCount;
+
+        }
+
+
+        /*
+
+            Desc: Finds Every Placement Of newPiece Reachable From Where GameCore Spawns It.
+
+            Preconditions:
+                1.) newPiece Is A Valid Index Into The PieceTable.
+
+            Postconditions:
+                1.) Same As The Positional generate.
+
+        */
+        unsigned int generate(const Bits& board, unsigned int newPiece)
+        {
+
+            return generate(board, newPiece, 0, 0, PIECE_TABLE_FOR<Cols>.get(newPiece, 0).spawnCol);
+
+        }
+
+
+        /*
+
+            Desc: Writes Out Inputs Taking The Piece From The Start Position To A
+            Placement. The Path Is Rebuilt Backwards From The Placement, Climbing A Row
+            Whenever The State Above Was Reached And Otherwise Taking The Fewest Shifts
+            & Turns Within The Row, So Sideways Moves Happen As Late As Possible. Soft
+            Drops Running Straight Into A Resting Spot Are Written As One Hard Drop.
+
+            Preconditions:
+                1.) target Came From The Latest generate.
+                2.) out Has Room For MAX_PATH_LENGTH Inputs.
+
+            Postconditions:
+                1.) out Holds The Path As MOVE_INPUT Characters, First Input First.
+                2.) Returns The Path's Length.
+
+        */
+        unsigned int getPath(const Placement& target, char* out) const
+        {
+
+            // Walk Back Up To The Start Row, Last Input First
+            unsigned int length = 0;
+            unsigned int rotation = target.rotation, row = target.row, col = target.col;
+            for (;;) {
+                walkRow(rotation, row, col, out, length, rotation, col);
+                if (row == startRow) break;
+                out[length++] = MOVE_INPUT::SOFT_DROP;
+                --row;
+            }
+
+            for (unsigned int i = 0; i < length / 2; ++i) {
+                char swapped = out[i];
+                out[i] = out[length - 1 - i];
+                out[length - 1 - i] = swapped;
+            }
+
+            // Replay It, Folding Runs Of Soft Drops Which End At Rest Into Hard Drops
+            unsigned int written = 0;
+            rotation = startRotation;
+            row = startRow;
+            col = startCol;
+            for (unsigned int i = 0; i < length; ) {
+                const char input = out[i];
+                if (input == MOVE_INPUT::SOFT_DROP)
+                {
+                    unsigned int run = 0;
+                    while (i + run < length && out[i + run] == MOVE_INPUT::SOFT_DROP) ++run;
+
+                    if (run > 1 && restsAt(rotation, row + run, col))
+                    {
+                        out[written++] = MOVE_INPUT::HARD_DROP;
+                    }
+                    else
+                    {
+                        for (unsigned int j = 0; j < run; ++j) out[written++] = MOVE_INPUT::SOFT_DROP;
+                    }
+
+                    row += run;
+                    i += run;
+                    continue;
+                }
+
+                if (input == MOVE_INPUT::LEFT) --col;
+                else if (input == MOVE_INPUT::RIGHT) ++col;
+                else rotation = (rotation + 1) % ROTATION_COUNT;
+
+                out[written++] = input;
+                ++i;
+            }
+
+            return written;
+
+        }
+
+
+        // Getters
+        unsigned int getPlacementCount() const { return placementCount; }
+        const Placement& getPlacement(unsigned int index) const { return placements[index]; }
+        unsigned int getPiece() const { return piece; }
+        bool isReachable(unsigned int rotation, unsigned int row, unsigned int col) const { return (reached[rotation][row] >> col) & 1u; }
+
+};
+
+
+/*
+
+    Desc: Locks A Placement Into A Bit Board And Clears Any Lines It Completes,
+    Without Playing It Through A Game.
+
+    Preconditions:
+        1.) placement Came From A MoveGenerator Search Of piece On board.
+
+    Postconditions:
+        1.) The Piece's Cells Are Occupied And Full Rows Are Removed.
+        2.) Returns How Many Lines Were Cleared.
+
+*/
+template <unsigned int Rows, unsigned int Cols>
+unsigned int applyPlacement(BitBoard<Rows, Cols>& board, unsigned int piece, const Placement& placement)
+{
+
+    const PieceRotation& shape = PIECE_TABLE_FOR<Cols>.get(piece, placement.rotation);
+    board.place(shape.rows, shape.height, placement.row, placement.col);
+    return board.clearFullRows();
+
+}
+
+
+/*
+
+    Desc: Plays A Path From MoveGenerator::getPath Into A Game Through The Same Calls
+    Window::handleKeyInput Makes For Each Key, Leaving The Active Piece Resting Where
+    The Path Ends (One More step Locks It). game Is A GameCore Or Anything With Its
+    Input Functions, Like Our Board.
+
+    Preconditions:
+        1.) game's Active Piece Is The One The Path Was Generated For, At Its Start Position.
+
+    Postconditions:
+        1.) Every Input Of path Has Been Applied To game.
+
+*/
+template <typename Game>
+void playPath(Game& game, const char* path, unsigned int length)
+{
+
+    for (unsigned int i = 0; i < length; ++i) {
+        switch (path[i])
+        {
+
+            case MOVE_INPUT::LEFT:
+            case MOVE_INPUT::RIGHT:
+                game.shiftActivePiece(path[i]);
+                game.ghostPiece();
+                break;
+            case MOVE_INPUT::ROTATE:
+                game.rotateActivePiece();
+                game.ghostPiece();
+                break;
+            case MOVE_INPUT::SOFT_DROP:
+                game.step();
+                break;
+            case MOVE_INPUT::HARD_DROP:
+                game.shiftActivePiece(path[i]);
+                break;
+
+        }
+    }
+
+}
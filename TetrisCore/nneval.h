@@ -0,0 +1,427 @@
+#pragma once
+
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdlib>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <string>
+#include "bitboard.h"
+#include "mappedfile.h"
+#include "movegen.h"
+#include "nnkernel.h"
+#include "pieces.h"
+#include "config.h"
+
+
+
+/*
+
+    Desc: The First 64 Bytes Of A Network Weights File. The Sections Follow In This
+    Order, Each Starting On A 64-Byte Boundary, All Little-Endian:
+
+        Input Weights   int8  [Rows * Cols + CONFIG::NN_LINE_INPUTS][hidden1]   (One Column Per Input)
+        Input Biases    int16 [hidden1]
+        Hidden Weights  int8  [hidden2][hidden1]                                (One Row Per Neuron)
+        Hidden Biases   int32 [hidden2]
+        Output Weights  int8  [hidden2]
+        Output Bias     int32
+
+    Input Row * Cols + Col Is 1 When That Cell Is Filled, And Input Rows * Cols + n
+    Is 1 When n Lines Were Cleared Getting There (4 Or More Share The Last). A Hidden1
+    Neuron's Bias Plus The Magnitudes Of Its Cell Weights And Its Largest Line Weight
+    Must Fit In int16, Or The File Is Refused.
+
+*/
+struct NetworkHeader
+{
+
+    static constexpr std::uint32_t MAGIC = 0x314E4E54;      // "TNN1"
+    static constexpr std::uint32_t VERSION = 1;
+
+    std::uint32_t magic;
+    std::uint32_t version;
+    std::uint32_t rows, cols;
+    std::uint32_t hidden1, hidden2;         // Neurons In Each Hidden Layer, Multiples Of 32
+    std::uint32_t shift1, shift2;           // Right Shift Bringing Each Hidden Layer's Sums Down To Activations
+    float outputScale;                      // Score Of One Unit Of Output
+    std::uint32_t reserved[7];
+
+};
+
+static_assert(sizeof(NetworkHeader) == 64, "Weights Files Start With A 64-Byte Header");
+
+
+/*
+
+    Desc: Where Each Section Of A Weights File Starts, And How Long The File Is.
+
+*/
+struct NetworkLayout
+{
+
+    std::size_t inputWeights, inputBiases;
+    std::size_t hiddenWeights, hiddenBiases;
+    std::size_t outputWeights, outputBias;
+    std::size_t bytes;
+
+};
+
+
+/*
+
+    Desc: Lays Out The Sections Following header.
+
+    Preconditions:
+        1.) None
+
+    Postconditions:
+        1.) Returns Every Section's Offset From The Start Of The File And The File's Length.
+
+*/
+inline NetworkLayout networkLayout(const NetworkHeader& header)
+{
+
+    auto align = [](std::size_t offset) { return (offset + 63) / 64 * 64; };
+    const std::size_t inputs = std::size_t(header.rows) * header.cols + CONFIG::NN_LINE_INPUTS;
+
+    NetworkLayout layout;
+    layout.inputWeights = sizeof(NetworkHeader);
+    layout.inputBiases = align(layout.inputWeights + inputs * header.hidden1);
+    layout.hiddenWeights = align(layout.inputBiases + sizeof(std::int16_t) * header.hidden1);
+    layout.hiddenBiases = align(layout.hiddenWeights + std::size_t(header.hidden2) * header.hidden1);
+    layout.outputWeights = align(layout.hiddenBiases + sizeof(std::int32_t) * header.hidden2);
+    layout.outputBias = align(layout.outputWeights + header.hidden2);
+    layout.bytes = layout.outputBias + sizeof(std::int32_t);
+    return layout;
+
+}
+
+
+/*
+
+    Desc: Scores Boards With A Small Quantized Network In Place Of The Hand-Picked
+    Features Of evaluateBoard(). The Weights Are An 8-Bit Two-Hidden-Layer MLP Over
+    Every Cell Of The Grid, Mapped Straight From A Weights File So Loading Is
+    Instant. Because Inputs Are Just Filled Cells, The First Layer Is The Sum Of
+    One Weight Column Per Filled Cell; Placements That Clear No Lines Only Add Their
+    Piece's Four Columns To Their Parent's Sums, So Scoring Every Placement Of A
+    Piece Costs Little More Than The Two Small Layers Above. The Kernels Come From
+    NN_KERNEL (AVX2, SSE2, Or Scalar), And Scratch Space Lives On The Stack, So
+    Evaluating Never Touches The Heap And Any Number Of Threads May Share One Evaluator.
+
+*/
+template <unsigned int Rows, unsigned int Cols>
+class NetworkEvaluator
+{
+
+    public:
+
+        using Bits = BitBoard<Rows, Cols>;
+        using Generator = MoveGenerator<Rows, Cols>;
+
+        static constexpr unsigned int INPUTS = Rows * Cols + CONFIG::NN_LINE_INPUTS;
+
+
+    private:
+
+        MappedFile file;
+        NetworkHeader header;
+
+        const std::int8_t* inputWeights;
+        const std::int16_t* inputBiases;
+        const std::int8_t* hiddenWeights;
+        const std::int32_t* hiddenBiases;
+        const std::int8_t* outputWeights;
+        std::int32_t outputBias;
+
+
+        // First Layer Sums, Sized For The Widest Network
+        struct alignas(32) Accumulator
+        {
+
+            std::int16_t values[CONFIG::NN_MAX_HIDDEN];
+
+        };
+
+
+        const std::int8_t* column(unsigned int input) const
+        {
+            return inputWeights + std::size_t(input) * header.hidden1;
+        }
+
+
+        static unsigned int lowestBit(std::uint32_t bits)
+        {
+            unsigned int index = 0;
+            while (!((bits >> index) & 1u)) ++index;
+            return index;
+        }
+
+
+        /*
+
+            Desc: Sums The First Layer For Every Filled Cell Of board.
+
+            Preconditions:
+                1.) A Network Is Loaded.
+
+            Postconditions:
+                1.) accumulator Holds The Biases Plus The Column Of Each Filled Cell (Lines Not Yet Added).
+
+        */
+        template <typename Kernel>
+        void accumulate(const Bits& board, Accumulator& accumulator) const
+        {
+
+            std::memcpy(accumulator.values, inputBiases, sizeof(std::int16_t) * header.hidden1);
+            for (unsigned int row = 0; row < Rows; ++row) {
+                for (std::uint32_t filled = board.getRow(row); filled; filled &= filled - 1) {
+                    const unsigned int col = static_cast<unsigned int>(lowestBit(filled));
+                    Kernel::addColumn(accumulator.values, column(row * Cols + col), header.hidden1);
+                }
+            }
+
+        }
+
+
+        /*
+
+            Desc: Runs The Layers Above The First.
+
+            Preconditions:
+                1.) accumulator Holds A Board's First Layer Sums, Lines Included.
+
+            Postconditions:
+                1.) Returns The Board's Score.
+
+        */
+        template <typename Kernel>
+        float finish(const Accumulator& accumulator) const
+        {
+
+            alignas(32) std::uint8_t first[CONFIG::NN_MAX_HIDDEN];
+            alignas(32) std::uint8_t second[CONFIG::NN_MAX_HIDDEN];
+
+            Kernel::activate(accumulator.values, header.shift1, first, header.hidden1);
+
+            for (unsigned int neuron = 0; neuron < header.hidden2; ++neuron) {
+                const std::int32_t sum = Kernel::dot(first, hiddenWeights + std::size_t(neuron) * header.hidden1, header.hidden1) + hiddenBiases[neuron];
+                second[neuron] = static_cast<std::uint8_t>(std::clamp(sum >> header.shift2, 0, static_cast<std::int32_t>(NN_KERNEL::ACTIVATION_MAX)));
+            }
+
+            return (Kernel::dot(second, outputWeights, header.hidden2) + outputBias) * header.outputScale;
+
+        }
+
+
+        /*
+
+            Desc: Tests Whether Every First Layer Sum Stays Inside 16 Bits Whatever Board
+            It Is Summed For: Its Bias Plus Every Cell Column's Weight And The Largest Line
+            Column's, All Taken At Their Magnitude. Past That, Saturating Adds Would Depend
+            On The Order Columns Were Added In, And Adding A Piece's Cells To Its Parent's
+            Sums Would No Longer Match Summing The Child From Scratch.
+
+            Preconditions:
+                1.) The Weights & Biases Are Mapped.
+
+            Postconditions:
+                1.) Returns True If No Board Can Saturate Any First Layer Sum.
+
+        */
+        bool firstLayerFits() const
+        {
+
+            for (unsigned int neuron = 0; neuron < header.hidden1; ++neuron) {
+                std::int32_t bound = std::abs(static_cast<std::int32_t>(inputBiases[neuron]));
+                for (unsigned int input = 0; input < Rows * Cols; ++input) {
+                    bound += std::abs(static_cast<std::int32_t>(column(input)[neuron]));
+                }
+
+                std::int32_t widestLine = 0;
+                for (unsigned int lines = 0; lines < CONFIG::NN_LINE_INPUTS; ++lines) {
+                    widestLine = std::max(widestLine, std::abs(static_cast<std::int32_t>(column(Rows * Cols + lines)[neuron])));
+                }
+
+                if (bound + widestLine > std::numeric_limits<std::int16_t>::max()) return false;
+            }
+            return true;
+
+        }
+
+
+        template <typename Kernel>
+        void addLines(Accumulator& accumulator, unsigned int lines) const
+        {
+            Kernel::addColumn(accumulator.values, column(Rows * Cols + std::min(lines, CONFIG::NN_LINE_INPUTS - 1)), header.hidden1);
+        }
+
+
+    public:
+
+        NetworkEvaluator()
+            : header{}, inputWeights(nullptr), inputBiases(nullptr), hiddenWeights(nullptr), hiddenBiases(nullptr),
+            outputWeights(nullptr), outputBias(0)
+        {
+        }
+
+
+        /*
+
+            Desc: Maps The Weights File At path, Replacing Any Network Loaded Before.
+
+            Preconditions:
+                1.) Nothing Is Being Evaluated.
+
+            Postconditions:
+                1.) Returns False, Leaving No Network Loaded, If The File Is Missing, Truncated, Or Not For A Rows x Cols Board.
+                2.) Also Returns False If Some Board Could Push A First Layer Sum Past 16 Bits (See firstLayerFits()).
+                3.) Otherwise The File Stays Mapped Until The Next load() Or Destruction.
+
+        */
+        bool load(const std::string& path)
+        {
+
+            inputWeights = nullptr;
+            if (!file.open(path) || file.getSize() < sizeof(NetworkHeader)) return false;
+
+            std::memcpy(&header, file.getData(), sizeof(NetworkHeader));
+
+            const bool valid = header.magic == NetworkHeader::MAGIC && header.version == NetworkHeader::VERSION &&
+                header.rows == Rows && header.cols == Cols &&
+                header.hidden1 && header.hidden1 <= CONFIG::NN_MAX_HIDDEN && header.hidden1 % 32 == 0 &&
+                header.hidden2 && header.hidden2 <= CONFIG::NN_MAX_HIDDEN && header.hidden2 % 32 == 0 &&
+                header.shift1 < 16 && header.shift2 < 32;
+
+            const NetworkLayout layout = networkLayout(header);
+            if (!valid || file.getSize() < layout.bytes)
+            {
+                file.close();
+                return false;
+            }
+
+            const unsigned char* data = file.getData();
+            inputWeights = reinterpret_cast<const std::int8_t*>(data + layout.inputWeights);
+            inputBiases = reinterpret_cast<const std::int16_t*>(data + layout.inputBiases);
+            hiddenWeights = reinterpret_cast<const std::int8_t*>(data + layout.hiddenWeights);
+            hiddenBiases = reinterpret_cast<const std::int32_t*>(data + layout.hiddenBiases);
+            outputWeights = reinterpret_cast<const std::int8_t*>(data + layout.outputWeights);
+            std::memcpy(&outputBias, data + layout.outputBias, sizeof(std::int32_t));
+
+            if (!firstLayerFits())
+            {
+                inputWeights = nullptr;
+                file.close();
+                return false;
+            }
+            return true;
+
+        }
+
+
+        /*
+
+            Desc: Scores One Board, Reached By Clearing lines Lines.
+
+            Preconditions:
+                1.) A Network Is Loaded.
+
+            Postconditions:
+                1.) Returns The Board's Worth (Higher Is Better).
+
+        */
+        template <typename Kernel = NN_KERNEL::Best>
+        float evaluate(const Bits& board, unsigned int lines) const
+        {
+
+            Accumulator accumulator;
+            accumulate<Kernel>(board, accumulator);
+            addLines<Kernel>(accumulator, lines);
+            return finish<Kernel>(accumulator);
+
+        }
+
+
+        /*
+
+            Desc: Scores count Boards At Once.
+
+            Preconditions:
+                1.) A Network Is Loaded; boards, lines, And scores Each Hold count Entries.
+
+            Postconditions:
+                1.) scores[i] Is evaluate(boards[i], lines[i]).
+
+        */
+        template <typename Kernel = NN_KERNEL::Best>
+        void evaluateBatch(const Bits* boards, const unsigned int* lines, unsigned int count, float* scores) const
+        {
+
+            for (unsigned int i = 0; i < count; ++i) {
+                scores[i] = evaluate<Kernel>(boards[i], lines[i]);
+            }
+
+        }
+
+
+        /*
+
+            Desc: Scores The Board Left By Each Placement generator Holds Of piece On
+            board, Summing board's First Layer Once And Adding Just The Piece's Cells
+            For Every Placement That Clears Nothing.
+
+            Preconditions:
+                1.) A Network Is Loaded; generator Was Last Run On board & piece.
+                2.) scores Holds generator.getPlacementCount() Entries.
+
+            Postconditions:
+                1.) scores[i] Is evaluate() Of The Board Placement i Leaves, With Its Lines Cleared (Exactly,
+                    As load() Only Accepts Networks Whose First Layer Sums Never Saturate).
+                2.) Returns How Many Placements Were Scored.
+
+        */
+        template <typename Kernel = NN_KERNEL::Best>
+        unsigned int evaluatePlacements(const Bits& board, unsigned int piece, const Generator& generator, float* scores) const
+        {
+
+            const unsigned int count = generator.getPlacementCount();
+            if (!count) return 0;
+
+            Accumulator parent, child;
+            accumulate<Kernel>(board, parent);
+
+            for (unsigned int i = 0; i < count; ++i) {
+                const Placement& placement = generator.getPlacement(i);
+                Bits after = board;
+                const unsigned int lines = applyPlacement(after, piece, placement);
+
+                if (lines)
+                {
+                    // Rows Moved, So The Sums Start Over
+                    accumulate<Kernel>(after, child);
+                }
+                else
+                {
+                    std::memcpy(child.values, parent.values, sizeof(std::int16_t) * header.hidden1);
+                    const PieceRotation& shape = PIECE_TABLE_FOR<Cols>.get(piece, placement.rotation);
+                    for (unsigned int cell = 0; cell < PIECE_CELLS; ++cell) {
+                        Kernel::addColumn(child.values, column((placement.row + shape.cellRow[cell]) * Cols + placement.col + shape.cellCol[cell]), header.hidden1);
+                    }
+                }
+
+                addLines<Kernel>(child, lines);
+                scores[i] = finish<Kernel>(child);
+            }
+            return count;
+
+        }
+
+
+        // Getters
+        bool isLoaded() const { return inputWeights != nullptr; }
+        const NetworkHeader& getHeader() const { return header; }
+
+};
@@ -0,0 +1,170 @@
+#pragma once
+
+
+#include <algorithm>
+#include <cstdint>
+#include "simd.h"
+
+#ifdef TETRIS_SIMD_AVX2
+#include <immintrin.h>
+#endif
+
+
+
+/*
+
+    Desc: The Three Loops A Quantized Network Spends Its Time In, Once Per Instruction
+    Set Like Our SIMD Flavours: Adding An 8-Bit Weight Column Into 16-Bit Accumulators
+    (Saturating), Squashing Accumulators Into 0..127 Activations (Clipped ReLU After
+    A Right Shift), And The Dot Product Of Activations With 8-Bit Weights Into 32
+    Bits. Activations Never Pass 127, So No Flavour's Pairwise Sums Can Saturate And
+    Every Flavour Returns Exactly What Scalar Does. Saturating Adds Do Depend On The
+    Order Columns Arrive In, So Callers Wanting Order-Independent Sums Must Keep Them
+    Inside 16 Bits (NetworkEvaluator Refuses Networks That Could Leave It). Lengths
+    Are Multiples Of 32.
+
+*/
+namespace NN_KERNEL
+{
+
+    // Largest Activation, Keeping Pairs Of Products Inside 16 Bits
+    constexpr std::int16_t ACTIVATION_MAX = 127;
+
+
+    // One Value At A Time, For Targets Without SSE2 (And For Checking The Others)
+    struct Scalar
+    {
+
+        static void addColumn(std::int16_t* accumulators, const std::int8_t* column, unsigned int length)
+        {
+            for (unsigned int i = 0; i < length; ++i) {
+                const int sum = accumulators[i] + column[i];
+                accumulators[i] = static_cast<std::int16_t>(std::clamp(sum, -32768, 32767));
+            }
+        }
+
+        static void activate(const std::int16_t* accumulators, unsigned int shift, std::uint8_t* activations, unsigned int length)
+        {
+            for (unsigned int i = 0; i < length; ++i) {
+                const int value = accumulators[i] >> shift;
+                activations[i] = static_cast<std::uint8_t>(std::clamp(value, 0, static_cast<int>(ACTIVATION_MAX)));
+            }
+        }
+
+        static std::int32_t dot(const std::uint8_t* activations, const std::int8_t* weights, unsigned int length)
+        {
+            std::int32_t sum = 0;
+            for (unsigned int i = 0; i < length; ++i) {
+                sum += static_cast<std::int32_t>(activations[i]) * weights[i];
+            }
+            return sum;
+        }
+
+    };
+
+
+#ifdef TETRIS_SIMD_SSE2
+
+    // Eight Accumulators Or Sixteen Activations Per 128-Bit Register
+    struct SSE2
+    {
+
+        static void addColumn(std::int16_t* accumulators, const std::int8_t* column, unsigned int length)
+        {
+            for (unsigned int i = 0; i < length; i += 8) {
+                // Sign-Extend Eight Weights By Doubling Each Byte And Shifting Back Down
+                const __m128i bytes = _mm_loadl_epi64(reinterpret_cast<const __m128i*>(column + i));
+                const __m128i wide = _mm_srai_epi16(_mm_unpacklo_epi8(bytes, bytes), 8);
+                __m128i* slot = reinterpret_cast<__m128i*>(accumulators + i);
+                _mm_storeu_si128(slot, _mm_adds_epi16(_mm_loadu_si128(slot), wide));
+            }
+        }
+
+        static void activate(const std::int16_t* accumulators, unsigned int shift, std::uint8_t* activations, unsigned int length)
+        {
+            const __m128i count = _mm_cvtsi32_si128(static_cast<int>(shift));
+            const __m128i zero = _mm_setzero_si128();
+            const __m128i top = _mm_set1_epi16(ACTIVATION_MAX);
+            for (unsigned int i = 0; i < length; i += 16) {
+                __m128i low = _mm_sra_epi16(_mm_loadu_si128(reinterpret_cast<const __m128i*>(accumulators + i)), count);
+                __m128i high = _mm_sra_epi16(_mm_loadu_si128(reinterpret_cast<const __m128i*>(accumulators + i + 8)), count);
+                low = _mm_min_epi16(_mm_max_epi16(low, zero), top);
+                high = _mm_min_epi16(_mm_max_epi16(high, zero), top);
+                _mm_storeu_si128(reinterpret_cast<__m128i*>(activations + i), _mm_packus_epi16(low, high));
+            }
+        }
+
+        static std::int32_t dot(const std::uint8_t* activations, const std::int8_t* weights, unsigned int length)
+        {
+            const __m128i zero = _mm_setzero_si128();
+            __m128i sum = _mm_setzero_si128();
+            for (unsigned int i = 0; i < length; i += 16) {
+                const __m128i a = _mm_loadu_si128(reinterpret_cast<const __m128i*>(activations + i));
+                const __m128i w = _mm_loadu_si128(reinterpret_cast<const __m128i*>(weights + i));
+                const __m128i aLow = _mm_unpacklo_epi8(a, zero), aHigh = _mm_unpackhi_epi8(a, zero);
+                const __m128i wLow = _mm_srai_epi16(_mm_unpacklo_epi8(w, w), 8), wHigh = _mm_srai_epi16(_mm_unpackhi_epi8(w, w), 8);
+                sum = _mm_add_epi32(sum, _mm_add_epi32(_mm_madd_epi16(aLow, wLow), _mm_madd_epi16(aHigh, wHigh)));
+            }
+            return horizontalSum(sum);
+        }
+
+        static std::int32_t horizontalSum(__m128i sum)
+        {
+            sum = _mm_add_epi32(sum, _mm_shuffle_epi32(sum, 0x4E));
+            sum = _mm_add_epi32(sum, _mm_shuffle_epi32(sum, 0xB1));
+            return _mm_cvtsi128_si32(sum);
+        }
+
+    };
+
+#endif
+
+
+#ifdef TETRIS_SIMD_AVX2
+
+    // Sixteen Accumulators Or Thirty-Two Activations Per 256-Bit Register
+    struct AVX2
+    {
+
+        static void addColumn(std::int16_t* accumulators, const std::int8_t* column, unsigned int length)
+        {
+            for (unsigned int i = 0; i < length; i += 16) {
+                const __m256i wide = _mm256_cvtepi8_epi16(_mm_loadu_si128(reinterpret_cast<const __m128i*>(column + i)));
+                __m256i* slot = reinterpret_cast<__m256i*>(accumulators + i);
+                _mm256_storeu_si256(slot, _mm256_adds_epi16(_mm256_loadu_si256(slot), wide));
+            }
+        }
+
+        // Only Runs Once Per Layer, So Isn't Worth Undoing AVX2's Per-Half Packing
+        static void activate(const std::int16_t* accumulators, unsigned int shift, std::uint8_t* activations, unsigned int length)
+        {
+            SSE2::activate(accumulators, shift, activations, length);
+        }
+
+        static std::int32_t dot(const std::uint8_t* activations, const std::int8_t* weights, unsigned int length)
+        {
+            const __m256i ones = _mm256_set1_epi16(1);
+            __m256i sum = _mm256_setzero_si256();
+            for (unsigned int i = 0; i < length; i += 32) {
+                const __m256i a = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(activations + i));
+                const __m256i w = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(weights + i));
+                sum = _mm256_add_epi32(sum, _mm256_madd_epi16(_mm256_maddubs_epi16(a, w), ones));
+            }
+            return SSE2::horizontalSum(_mm_add_epi32(_mm256_castsi256_si128(sum), _mm256_extracti128_si256(sum, 1)));
+        }
+
+    };
+
+#endif
+
+
+    // Widest Flavour The Target Has
+#if defined(TETRIS_SIMD_AVX2)
+    using Best = AVX2;
+#elif defined(TETRIS_SIMD_SSE2)
+    using Best = SSE2;
+#else
+    using Best = Scalar;
+#endif
+
+}
@@ -0,0 +1,98 @@
+#include "openingbook.h"
+#include <algorithm>
+#include <cstring>
+#include <fstream>
+
+
+/*
+
+    Desc: Writes A Book File Of entries.
+
+    Preconditions:
+        1.) entries Are Sorted By key, With No Key Twice.
+
+    Postconditions:
+        1.) Returns False If path Couldn't Be Written.
+
+*/
+bool writeOpeningBook(const std::string& path, unsigned int rows, unsigned int cols, unsigned int pieces, const std::vector<BookEntry>& entries)
+{
+
+    std::ofstream file(path, std::ios::binary | std::ios::trunc);
+    if (!file.is_open()) return false;
+
+    const BookHeader header{ BookHeader::MAGIC, BookHeader::VERSION, rows, cols, pieces, 0, entries.size() };
+    file.write(reinterpret_cast<const char*>(&header), sizeof(header));
+    file.write(reinterpret_cast<const char*>(entries.data()), static_cast<std::streamsize>(entries.size() * sizeof(BookEntry)));
+    return static_cast<bool>(file);
+
+}
+
+
+OpeningBook::OpeningBook()
+    : entries(nullptr), entryCount(0), pieces(0)
+{
+}
+
+
+/*
+
+    Desc: Maps The Book At path, Replacing Any Book Opened Before.
+
+    Preconditions:
+        1.) Nothing Is Looking Anything Up.
+
+    Postconditions:
+        1.) Returns False, Leaving No Book Open, If The File Is Missing, Truncated, Or Not For A rows x cols Board.
+
+*/
+bool OpeningBook::open(const std::string& path, unsigned int rows, unsigned int cols)
+{
+
+    entries = nullptr;
+    entryCount = 0;
+    if (!file.open(path) || file.getSize() < sizeof(BookHeader)) return false;
+
+    BookHeader header;
+    std::memcpy(&header, file.getData(), sizeof(header));
+    if (header.magic != BookHeader::MAGIC || header.version != BookHeader::VERSION || header.rows != rows || header.cols != cols ||
+        header.entryCount > (file.getSize() - sizeof(BookHeader)) / sizeof(BookEntry))
+    {
+        file.close();
+        return false;
+    }
+
+    entries = reinterpret_cast<const BookEntry*>(file.getData() + sizeof(BookHeader));
+    entryCount = static_cast<std::size_t>(header.entryCount);
+    pieces = header.pieces;
+    return true;
+
+}
+
+
+/*
+
+    Desc: Binary Searches The Book For key.
+
+    Preconditions:
+        1.) None
+
+    Postconditions:
+        1.) Returns True And Sets placement If The Book Has key.
+
+*/
+bool OpeningBook::lookup(std::uint64_t key, Placement& placement) const
+{
+
+    if (!entries) return false;
+
+    const BookEntry* found = std::lower_bound(entries, entries + entryCount, key,
+        [](const BookEntry& entry, std::uint64_t value) { return entry.key < value; });
+    if (found == entries + entryCount || found->key != key) return false;
+
+    placement.rotation = found->rotation;
+    placement.row = found->row;
+    placement.col = found->col;
+    return true;
+
+}
@@ -0,0 +1,146 @@
+#pragma once
+
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+#include "bitboard.h"
+#include "mappedfile.h"
+#include "movegen.h"
+#include "zobrist.h"
+#include "config.h"
+
+
+
+/*
+
+    Desc: One Position Of An Opening Book: The Key Of A Board & The Piece To Place
+    On It, And The Placement Chosen For Them.
+
+*/
+struct BookEntry
+{
+
+    std::uint64_t key;              // bookKey() Of The Board & Piece
+    std::uint8_t rotation, row, col;
+    std::uint8_t reserved;
+    std::uint32_t votes;            // Bag Orders Whose Best Line Played This Placement Here
+
+};
+
+static_assert(sizeof(BookEntry) == 16, "Book Entries Are Read Straight From The Mapped File");
+
+
+/*
+
+    Desc: The First 32 Bytes Of An Opening Book File, Followed By entryCount
+    BookEntries Sorted By key.
+
+*/
+struct BookHeader
+{
+
+    static constexpr std::uint32_t MAGIC = 0x31424F54;      // "TOB1"
+    static constexpr std::uint32_t VERSION = 1;
+
+    std::uint32_t magic;
+    std::uint32_t version;
+    std::uint32_t rows, cols;
+    std::uint32_t pieces;           // Pieces Of Each Game The Book Was Built For
+    std::uint32_t reserved;
+    std::uint64_t entryCount;
+
+};
+
+static_assert(sizeof(BookHeader) == 32, "Book Files Start With A 32-Byte Header");
+
+
+/*
+
+    Desc: Names A Board & The Piece About To Be Placed On It In A Book; The Same
+    Key The Bot's Transposition Table Uses.
+
+    Preconditions:
+        1.) None
+
+    Postconditions:
+        1.) Returns The Zobrist Hash Of board XOR-ed With piece's Key.
+
+*/
+template <unsigned int Rows, unsigned int Cols>
+std::uint64_t bookKey(const BitBoard<Rows, Cols>& board, unsigned int piece)
+{
+
+    return hashBoard(board) ^ ZOBRIST_KEYS<Rows, Cols>.pieces[piece];
+
+}
+
+
+bool writeOpeningBook(const std::string& path, unsigned int rows, unsigned int cols, unsigned int pieces, const std::vector<BookEntry>& entries);
+
+
+/*
+
+    Desc: Placements Worked Out Offline For The Start Of A Game, Looked Up Instead Of
+    Searched. The File Is Memory Mapped As Is, So Opening It Parses Nothing, And Its
+    Entries Are Sorted By Key, So A Lookup Is One Binary Search (O(log n)). It's Only
+    Read Once Open, So Any Number Of Threads May Look Things Up At Once.
+
+*/
+class OpeningBook
+{
+
+    private:
+
+        MappedFile file;
+        const BookEntry* entries;
+        std::size_t entryCount;
+        unsigned int pieces;
+
+
+    public:
+
+        OpeningBook();
+
+        OpeningBook(const OpeningBook&) = delete;
+        OpeningBook& operator=(const OpeningBook&) = delete;
+
+        bool open(const std::string& path, unsigned int rows, unsigned int cols);
+        bool lookup(std::uint64_t key, Placement& placement) const;
+
+
+        /*
+
+            Desc: Looks Up The Placement Of piece On board, Checking It's Among The
+            Placements generator Found (So It's Reachable From Where The Piece Is).
+
+            Preconditions:
+                1.) generator Was Last Run On board & piece.
+
+            Postconditions:
+                1.) Returns The Placement's Index In generator, Or -1 If The Book Has None.
+
+        */
+        template <unsigned int Rows, unsigned int Cols>
+        int find(const BitBoard<Rows, Cols>& board, unsigned int piece, const MoveGenerator<Rows, Cols>& generator) const
+        {
+
+            Placement booked;
+            if (!lookup(bookKey(board, piece), booked)) return -1;
+
+            for (unsigned int i = 0; i < generator.getPlacementCount(); ++i) {
+                const Placement& placement = generator.getPlacement(i);
+                if (placement.rotation == booked.rotation && placement.row == booked.row && placement.col == booked.col) return static_cast<int>(i);
+            }
+            return -1;
+
+        }
+
+
+        // Getters
+        bool isOpen() const { return entries != nullptr; }
+        std::size_t getEntryCount() const { return entryCount; }
+        unsigned int getPieces() const { return pieces; }
+
+};
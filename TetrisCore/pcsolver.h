@@ -0,0 +1,366 @@
+#pragma once
+
+
+#include <array>
+#include <bitset>
+#include <chrono>
+#include <cstdint>
+#include <vector>
+#include "bitboard.h"
+#include "movegen.h"
+#include "transtable.h"
+#include "zobrist.h"
+#include "workpool.h"
+#include "config.h"
+
+
+
+/*
+
+    Desc: One Way To Empty A Board: The Placement Of Each Queued Piece, In Order.
+
+*/
+struct PerfectClear
+{
+
+    unsigned int length;
+    std::array<Placement, CONFIG::PC_MAX_PIECES> placements;
+
+};
+
+
+/*
+
+    Desc: Running Totals Of What A PerfectClearSolver Has Searched.
+
+*/
+struct PerfectClearStats
+{
+
+    std::uint64_t nodes;            // Fields Searched
+    double seconds;
+
+    double nodesPerSecond() const { return seconds > 0.0 ? nodes / seconds : 0.0; }
+
+};
+
+
+/*
+
+    Desc: Finds Every Sequence Of Placements Of A Known Piece Queue (No Hold) That
+    Empties A Board. For Each Stack Height Up To maxHeight Whose Empty Cells Make A
+    Whole Number Of Pieces, It Searches Depth First For Placements Staying Within
+    That Height, Lowering It Whenever Lines Clear, So The Field Is Empty Exactly
+    When The Last Needed Piece Lands, And Dropping Fields Split By A Filled Column
+    Into Sides That Can't Be Filled With Whole Pieces. Every Field Is A BitBoard And Every Placement
+    Comes From A MoveGenerator, So Only Placements Actually Reachable Are Tried.
+    Fields Found Not To Clear Are Remembered In A Shared TranspositionTable (Keyed
+    By Field, Height, And Pieces Placed) So No Two Orders Reaching The Same Field
+    Search It Twice, And The Search Below The First SPLIT_DEPTH Pieces Is Spread
+    Across A WorkPool, Each Worker Keeping A MoveGenerator Per Depth.
+
+*/
+template <unsigned int Rows, unsigned int Cols>
+class PerfectClearSolver
+{
+
+    public:
+
+        using Bits = BitBoard<Rows, Cols>;
+        using Generator = MoveGenerator<Rows, Cols>;
+
+        static constexpr unsigned int MAX_PIECES = CONFIG::PC_MAX_PIECES;
+
+        // Pieces Placed Up Front To Make Enough Independent Searches For Every Thread
+        static constexpr unsigned int SPLIT_DEPTH = 2;
+        static constexpr unsigned int NO_SPLIT = MAX_PIECES + 1;
+
+        static_assert(CONFIG::PC_MAX_HEIGHT <= Rows, "Perfect Clears Must Fit On The Board");
+
+
+    private:
+
+        // A Field Left After The First Pieces, Searched As One Task
+        struct Frontier
+        {
+
+            Bits board;
+            unsigned int height;
+            unsigned int depth;
+            PerfectClear path;
+
+        };
+
+        // One Worker's Search State
+        struct Worker
+        {
+
+            std::array<Generator, MAX_PIECES> generators;     // One Per Depth
+            std::uint64_t nodes;
+
+        };
+
+        WorkPool pool;
+        TranspositionTable memo;
+        std::vector<Worker> workers;
+
+        // Queue Being Solved, And How Many Of It The Current Height Needs
+        std::array<unsigned int, MAX_PIECES> pieces;
+        unsigned int neededPieces;
+
+        std::vector<Frontier> frontier;
+        std::vector<std::vector<PerfectClear>> found;         // Solutions Kept Per Frontier Task
+        std::vector<std::uint64_t> foundCounts;               // Solutions Counted Per Frontier Task
+
+        std::vector<PerfectClear> solutions;
+        std::uint64_t solutionCount;
+        PerfectClearStats stats;
+
+
+        /*
+
+            Desc: Names A Field Partway Through The Current Search For The Memo.
+
+            Preconditions:
+                1.) None
+
+            Postconditions:
+                1.) Returns A Key Shared Only By Equal Fields At Equal Height & Depth.
+
+        */
+        static std::uint64_t fieldKey(const Bits& board, unsigned int height, unsigned int depth)
+        {
+
+            return hashBoard(board) ^ (0x9E3779B97F4A7C15ull * (height + 1)) ^ (0xC2B2AE3D27D4EB4Full * (depth + 1));
+
+        }
+
+
+        /*
+
+            Desc: Checks Whether A Field Can't Possibly Clear Because A Column Filled
+            All The Way Up The Stack Walls Off A Side Whose Empty Cells Aren't A Whole
+            Number Of Pieces. Nothing Can Reach Across Such A Wall, And Clearing Lines
+            Only Lowers It, So Each Side Has To Be Filled On Its Own.
+
+            Preconditions:
+                1.) Nothing Is Filled Above The Bottom height Rows Of board.
+
+            Postconditions:
+                1.) Returns True If Some Walled-Off Side Can't Be Filled.
+
+        */
+        static bool isWalledOff(const Bits& board, unsigned int height)
+        {
+
+            typename Bits::RowMask walls = Bits::FULL_ROW;
+            for (unsigned int row = Rows - height; row < Rows; ++row) {
+                walls &= board.getRow(row);
+            }
+            if (!walls) return false;
+
+            // Empty Cells Left Of Each Wall Must Come In Fours (The Rightmost Side Follows From The Total)
+            for (unsigned int col = 0; col < Cols; ++col) {
+                if (!((walls >> col) & 1u)) continue;
+
+                const typename Bits::RowMask left = static_cast<typename Bits::RowMask>((1u << col) - 1u);
+                unsigned int filled = 0;
+                for (unsigned int row = Rows - height; row < Rows; ++row) {
+                    filled += static_cast<unsigned int>(std::bitset<32>(board.getRow(row) & left).count());
+                }
+                if ((col * height - filled) % PIECE_CELLS) return true;
+            }
+            return false;
+
+        }
+
+
+        /*
+
+            Desc: Searches Every Way Of Finishing The Clear From One Field, Stopping
+            Early Once The First Pieces Are Placed When Gathering this->frontier.
+
+            Preconditions:
+                1.) board Has Exactly 4 * (this->neededPieces - path.length) Empty Cells In Its Bottom height Rows And None Filled Above.
+                2.) worker Isn't Being Used By Any Other Search.
+
+            Postconditions:
+                1.) Returns How Many Solutions Were Found Below This Field; Up To CONFIG::PC_MAX_KEPT_SOLUTIONS Go Into kept.
+                2.) Unless splitDepth Is NO_SPLIT, Fields splitDepth Pieces In Are Put Into this->frontier Instead Of Searched.
+                3.) Fields Searched Through Without Any Solution Are Stored In this->memo.
+
+        */
+        std::uint64_t search(Worker& worker, const Bits& board, unsigned int height, PerfectClear& path, std::vector<PerfectClear>& kept, unsigned int splitDepth)
+        {
+
+            const unsigned int depth = path.length;
+
+            if (height == 0)
+            {
+                if (kept.size() < CONFIG::PC_MAX_KEPT_SOLUTIONS) kept.push_back(path);
+                return 1;
+            }
+
+            if (depth == splitDepth)
+            {
+                frontier.push_back({ board, height, depth, path });
+                return 0;
+            }
+
+            worker.nodes++;
+
+            const std::uint64_t key = fieldKey(board, height, depth);
+            TableHit hit;
+            if (memo.probe(key, hit)) return 0;
+
+            Generator& generator = worker.generators[depth];
+            const unsigned int placements = generator.generate(board, pieces[depth]);
+
+            std::uint64_t count = 0;
+            for (unsigned int i = 0; i < placements; ++i) {
+                const Placement& placement = generator.getPlacement(i);
+
+                // Every Cell Of The Piece Has To Sit Inside The Stack Being Cleared
+                if (placement.row < Rows - height) continue;
+
+                Bits child = board;
+                const unsigned int lines = applyPlacement(child, pieces[depth], placement);
+                if (isWalledOff(child, height - lines)) continue;
+
+                path.placements[depth] = placement;
+                path.length = depth + 1;
+                count += search(worker, child, height - lines, path, kept, splitDepth);
+            }
+            path.length = depth;
+
+            if (!count && splitDepth == NO_SPLIT) memo.store(key, 0.0f, Placement{}, neededPieces - depth);
+            return count;
+
+        }
+
+
+        /*
+
+            Desc: Finds Every Clear Of board Using Exactly The First needed Pieces, With
+            The Stack height Rows Tall.
+
+            Preconditions:
+                1.) board's Bottom height Rows Hold Exactly 4 * needed Empty Cells, With Nothing Above.
+
+            Postconditions:
+                1.) Every Clear Found Is Counted In this->solutionCount And Kept (Up To The Limit) In this->solutions.
+
+        */
+        void solveHeight(const Bits& board, unsigned int height, unsigned int needed)
+        {
+
+            neededPieces = needed;
+
+            // Place The First Pieces Here, Leaving Their Fields For The Workers
+            frontier.clear();
+            std::vector<PerfectClear> early;
+            PerfectClear path{};
+            solutionCount += search(workers[0], board, height, path, early, SPLIT_DEPTH < needed ? SPLIT_DEPTH : needed);
+            solutions.insert(solutions.end(), early.begin(), early.end());
+
+            found.assign(frontier.size(), {});
+            foundCounts.assign(frontier.size(), 0);
+
+            pool.parallelFor(static_cast<unsigned int>(frontier.size()), [this](unsigned int task, unsigned int worker) {
+                Frontier& start = frontier[task];
+                foundCounts[task] = search(workers[worker], start.board, start.height, start.path, found[task], NO_SPLIT);
+            });
+
+            // Gather In Frontier Order So Results Don't Depend On Thread Timing
+            for (unsigned int task = 0; task < frontier.size(); ++task) {
+                solutionCount += foundCounts[task];
+                for (const PerfectClear& solution : found[task]) {
+                    if (solutions.size() < CONFIG::PC_MAX_KEPT_SOLUTIONS) solutions.push_back(solution);
+                }
+            }
+
+        }
+
+
+    public:
+
+        /*
+
+            Desc: Creates A Solver Searching Across threads Threads, Remembering Dead
+            Fields In A tableMegabytes Table.
+
+            Preconditions:
+                1.) tableMegabytes Is At Least 1.
+
+            Postconditions:
+                1.) The WorkPool Is Started And Every Worker's Generators Allocated.
+
+        */
+        explicit PerfectClearSolver(unsigned int threads = std::thread::hardware_concurrency(), std::size_t tableMegabytes = CONFIG::PC_TABLE_MB)
+            : pool(threads), memo(tableMegabytes), workers(pool.getThreadCount()),
+            pieces{}, neededPieces(0), solutionCount(0), stats{}
+        {
+        }
+
+
+        /*
+
+            Desc: Finds Every Sequence Of Placements Of queue That Leaves board Empty,
+            With The Stack Never Taller Than maxHeight Rows.
+
+            Preconditions:
+                1.) queue Holds queueLength Pieces (Only The First MAX_PIECES Are Used).
+
+            Postconditions:
+                1.) Returns How Many Sequences Were Found, Shortest Stacks First.
+                2.) The First CONFIG::PC_MAX_KEPT_SOLUTIONS Of Them Can Be Read With getSolution().
+
+        */
+        std::uint64_t solve(const Bits& board, const unsigned int* queue, unsigned int queueLength, unsigned int maxHeight = CONFIG::PC_MAX_HEIGHT)
+        {
+
+            auto start = std::chrono::steady_clock::now();
+
+            solutions.clear();
+            solutionCount = 0;
+            memo.clear();
+            for (Worker& worker : workers) worker.nodes = 0;
+
+            if (queueLength > MAX_PIECES) queueLength = MAX_PIECES;
+            if (maxHeight > CONFIG::PC_MAX_HEIGHT) maxHeight = CONFIG::PC_MAX_HEIGHT;
+            for (unsigned int i = 0; i < queueLength; ++i) {
+                pieces[i] = queue[i];
+            }
+
+            // The Stack Has To Be At Least As Tall As What's Already On The Board
+            unsigned int filled = 0, minHeight = 1;
+            for (unsigned int row = 0; row < Rows; ++row) {
+                if (!board.getRow(row)) continue;
+                filled += static_cast<unsigned int>(std::bitset<32>(board.getRow(row)).count());
+                if (Rows - row > minHeight) minHeight = Rows - row;
+            }
+
+            for (unsigned int height = minHeight; height <= maxHeight; ++height) {
+                const unsigned int empty = height * Cols - filled;
+                if (empty % PIECE_CELLS || empty / PIECE_CELLS > queueLength) continue;
+
+                solveHeight(board, height, empty / PIECE_CELLS);
+            }
+
+            for (const Worker& worker : workers) stats.nodes += worker.nodes;
+            stats.seconds += std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+            return solutionCount;
+
+        }
+
+
+        // Getters
+        std::uint64_t getSolutionCount() const { return solutionCount; }
+        unsigned int getKeptCount() const { return static_cast<unsigned int>(solutions.size()); }
+        const PerfectClear& getSolution(unsigned int index) const { return solutions[index]; }
+        const PerfectClearStats& getStats() const { return stats; }
+        const TranspositionTable& getMemo() const { return memo; }
+        unsigned int getThreadCount() const { return pool.getThreadCount(); }
+
+};
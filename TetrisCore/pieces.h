@@ -0,0 +1,194 @@
+#pragma once
+
+
+#include <cstdint>
+#include "config.h"
+
+
+
+// Amount Of Distinct Pieces, Rotation States, And Cells Making Up A Piece
+constexpr unsigned int PIECE_COUNT = 7;
+constexpr unsigned int ROTATION_COUNT = 4;
+constexpr unsigned int PIECE_CELLS = 4;
+
+
+
+/*
+
+    Desc: Describes A Shape As A Small Grid Of Filled Cells Within Its Bounding Box.
+
+*/
+struct ShapeDefinition
+{
+
+    unsigned int height, width;
+    bool cells[PIECE_CELLS][PIECE_CELLS];
+
+};
+
+
+/*
+
+    Desc: Contains All Given Shapes We Can Expect To Drop And Utilize
+    In A Given Game Of Tetris.
+
+*/
+constexpr ShapeDefinition shapes[PIECE_COUNT] =
+{
+
+    { 1, 4, { {1, 1, 1, 1} } },           // I Shape
+    { 2, 2, { {1, 1}, {1, 1} } },         // O Shape
+    { 2, 3, { {0, 1, 0}, {1, 1, 1} } },   // T Shape
+    { 2, 3, { {1, 1, 0}, {0, 1, 1} } },   // S Shape
+    { 2, 3, { {0, 1, 1}, {1, 1, 0} } },   // Z Shape
+    { 2, 3, { {1, 0, 0}, {1, 1, 1} } },   // L Shape
+    { 2, 3, { {0, 0, 1}, {1, 1, 1} } }    // J Shape
+
+};
+
+
+
+/*
+
+    Desc: A Single Rotation State Of A Piece. this->rows Holds One Mask Per Row Of
+    The Bounding Box (Bit N Set For A Filled Cell In Column N) Anchored At Column 0,
+    And cellRow/cellCol Hold The Offsets Of The Filled Cells From The Top-Left Of The
+    Bounding Box So Drawing Never Has To Walk Empty Cells.
+
+*/
+struct PieceRotation
+{
+
+    std::uint8_t height, width;
+    std::uint8_t spawnCol;                  // Column The Piece Spawns At (Center Top)
+    std::uint16_t rows[PIECE_CELLS];
+    std::uint8_t cellRow[PIECE_CELLS];
+    std::uint8_t cellCol[PIECE_CELLS];
+    std::uint8_t topRow[PIECE_CELLS];       // Highest Filled Row Of Each Column (Its Top Profile)
+    std::uint8_t bottomRow[PIECE_CELLS];    // Lowest Filled Row Of Each Column (Its Bottom Profile)
+
+};
+
+
+/*
+
+    Desc: Every Rotation State Of Every Piece, Indexed By [piece][rotation]. Rotation
+    r + 1 Is Rotation r Turned 90 Degrees Clockwise About Its Top-Left Corner.
+
+*/
+struct PieceTable
+{
+
+    PieceRotation rotations[PIECE_COUNT][ROTATION_COUNT];
+
+    constexpr const PieceRotation& get(unsigned int piece, unsigned int rotation) const
+    {
+        return rotations[piece][rotation];
+    }
+
+};
+
+
+/*
+
+    Desc: Builds The PieceTable At Compile Time From Our shapes Definitions By
+    Repeatedly Turning Each Shape Clockwise.
+
+    Preconditions:
+        1.) boardCols Is Wide Enough To Hold The Widest Shape.
+
+    Postconditions:
+        1.) Returns A Table Holding All ROTATION_COUNT States Of All PIECE_COUNT Pieces.
+        2.) Each State's spawnCol Centers It On A Board boardCols Wide.
+        3.) Each State's topRow & bottomRow Hold Its Per-Column Profiles.
+
+*/
+constexpr PieceTable makePieceTable(unsigned int boardCols)
+{
+
+    PieceTable table{};
+
+    for (unsigned int piece = 0; piece < PIECE_COUNT; ++piece) {
+
+        // Working Copy Of The Shape Which Gets Turned Each Rotation
+        bool cells[PIECE_CELLS][PIECE_CELLS]{};
+        unsigned int height = shapes[piece].height;
+        unsigned int width = shapes[piece].width;
+
+        for (unsigned int i = 0; i < height; ++i) {
+            for (unsigned int j = 0; j < width; ++j) {
+                cells[i][j] = shapes[piece].cells[i][j];
+            }
+        }
+
+        for (unsigned int rotation = 0; rotation < ROTATION_COUNT; ++rotation) {
+
+            PieceRotation& state = table.rotations[piece][rotation];
+            state.height = static_cast<std::uint8_t>(height);
+            state.width = static_cast<std::uint8_t>(width);
+            state.spawnCol = static_cast<std::uint8_t>(boardCols / 2 - width / 2);
+
+            unsigned int cell = 0;
+            for (unsigned int i = 0; i < height; ++i) {
+                for (unsigned int j = 0; j < width; ++j) {
+                    if (cells[i][j])
+                    {
+                        state.rows[i] = static_cast<std::uint16_t>(state.rows[i] | (1u << j));
+                        state.cellRow[cell] = static_cast<std::uint8_t>(i);
+                        state.cellCol[cell] = static_cast<std::uint8_t>(j);
+                        ++cell;
+                    }
+                }
+            }
+
+            // Profile Each Column From Both Ends
+            for (unsigned int j = 0; j < width; ++j) {
+                unsigned int top = height, bottom = 0;
+                for (unsigned int i = 0; i < height; ++i) {
+                    if (cells[i][j])
+                    {
+                        if (top == height) top = i;
+                        bottom = i;
+                    }
+                }
+                state.topRow[j] = static_cast<std::uint8_t>(top);
+                state.bottomRow[j] = static_cast<std::uint8_t>(bottom);
+            }
+
+            // Turn The Shape Clockwise For The Next Rotation State
+            bool rotated[PIECE_CELLS][PIECE_CELLS]{};
+            for (unsigned int i = 0; i < height; ++i) {
+                for (unsigned int j = 0; j < width; ++j) {
+                    rotated[j][height - 1 - i] = cells[i][j];
+                }
+            }
+
+            for (unsigned int i = 0; i < PIECE_CELLS; ++i) {
+                for (unsigned int j = 0; j < PIECE_CELLS; ++j) {
+                    cells[i][j] = rotated[i][j];
+                }
+            }
+
+            unsigned int oldHeight = height;
+            height = width;
+            width = oldHeight;
+
+        }
+
+    }
+
+    return table;
+
+}
+
+
+// Rotation States Of Every Piece For A Board BoardCols Wide (Only spawnCol Differs)
+template <unsigned int BoardCols>
+constexpr PieceTable PIECE_TABLE_FOR = makePieceTable(BoardCols);
+
+// Rotation States Of Every Piece For Our Configured Board Width
+inline constexpr const PieceTable& PIECE_TABLE = PIECE_TABLE_FOR<CONFIG::BOARD_COLS>;
+
+static_assert(PIECE_TABLE.get(0, 1).height == 4 && PIECE_TABLE.get(0, 1).rows[3] == 0x1, "Vertical I Should Be One Column, Four Rows");
+static_assert(PIECE_TABLE.get(3, 0).bottomRow[0] == 0 && PIECE_TABLE.get(3, 0).topRow[2] == 1, "S Should Step Down From Left To Right");
+static_assert(PIECE_TABLE.get(2, 0).rows[0] == 0x2 && PIECE_TABLE.get(2, 0).rows[1] == 0x7, "T Should Point Up In Its Spawn State");
@@ -0,0 +1,130 @@
+#pragma once
+
+
+#include <cstdint>
+#include <utility>
+#include "block.h"
+#include "pieces.h"
+#include "xoshiro.h"
+#include "config.h"
+
+
+
+/*
+
+    Desc: The Seeded Sequence Of Pieces (And Their Colors) A Game Deals. Pieces Come
+    From A 7-Bag: Every Piece Once In A Shuffled Order, Then A Freshly Shuffled Bag,
+    So No Piece Is Ever Starved For Long. It's A Plain Value, So Anything Wanting To
+    Know What A Seed Deals (Like Searches Run Ahead Of A Game) Can Keep Its Own Copy.
+
+*/
+class PieceStream
+{
+
+    private:
+
+        Xoshiro256 rng;
+        std::uint64_t seed;                          // Seed The Current Stream Started From
+        std::uint8_t bag[PIECE_COUNT];               // Shuffled Set Of Every Piece Being Dealt Out
+        unsigned int bagIndex;                       // Next Piece Of bag To Deal (PIECE_COUNT When Empty)
+
+
+    public:
+
+        /*
+
+            Desc: Creates A Stream Starting From seedValue.
+
+            Preconditions:
+                1.) None
+
+            Postconditions:
+                1.) The Stream Is Seeded As If By reseed(seedValue).
+
+        */
+        explicit PieceStream(std::uint64_t seedValue = 0)
+            : rng(seedValue), seed(seedValue), bag{}, bagIndex(PIECE_COUNT)
+        {
+        }
+
+
+        /*
+
+            Desc: Restarts The Stream From newSeed; Equal Seeds Deal Equal Pieces.
+
+            Preconditions:
+                1.) None
+
+            Postconditions:
+                1.) this->rng Is Seeded With newSeed And The Bag Is Emptied.
+
+        */
+        void reseed(std::uint64_t newSeed)
+        {
+
+            seed = newSeed;
+            rng.seed(seed);
+            bagIndex = PIECE_COUNT;
+
+        }
+
+
+        /*
+
+            Desc: Deals The Next Piece Of The Bag Along With A Random One Of The
+            Palette's Piece Colors For It.
+
+            Preconditions:
+                1.) None
+
+            Postconditions:
+                1.) Returns An Index Into PIECE_TABLE; cell Is Set To Its Color.
+                2.) If The Bag Ran Out, It Is Refilled And Shuffled From this->rng.
+
+        */
+        unsigned int deal(Cell& cell)
+        {
+
+            if (bagIndex == PIECE_COUNT)
+            {
+                // Fisher-Yates Shuffle Of A Full Bag
+                for (unsigned int i = 0; i < PIECE_COUNT; ++i) {
+                    bag[i] = static_cast<std::uint8_t>(i);
+                }
+                for (unsigned int i = PIECE_COUNT - 1; i > 0; --i) {
+                    std::swap(bag[i], bag[rng.nextBelow(i + 1)]);
+                }
+                bagIndex = 0;
+            }
+
+            unsigned int piece = bag[bagIndex++];
+            cell = makeCell(OCCUPIED, PALETTE_FIRST_PIECE + rng.nextBelow(CONFIG::COLORS::PIECE_COLOR_COUNT));
+            return piece;
+
+        }
+
+
+        /*
+
+            Desc: Deals The Next Piece When Its Color Doesn't Matter.
+
+            Preconditions:
+                1.) None
+
+            Postconditions:
+                1.) Same As deal(Cell&), With The Color Thrown Away.
+
+        */
+        unsigned int deal()
+        {
+
+            Cell unused;
+            return deal(unused);
+
+        }
+
+
+        // Getters
+        std::uint64_t getSeed() const { return seed; }
+
+};
@@ -0,0 +1,306 @@
+#pragma once
+
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <limits>
+#include <vector>
+#include "evaluator.h"
+#include "movegen.h"
+#include "piecestream.h"
+#include "workpool.h"
+#include "xoshiro.h"
+#include "config.h"
+
+
+
+// How A Rollout Picks Each Placement Of Its Continuation
+enum class RolloutPolicy : unsigned int
+{
+    RANDOM,     // Any Reachable Placement, Uniformly
+    GREEDY      // The Placement evaluateBoard() Likes Best Right Now
+};
+
+
+/*
+
+    Desc: Running Totals Of What A RolloutEvaluator Has Simulated.
+
+*/
+struct RolloutStats
+{
+
+    std::uint64_t evaluations;      // Calls To evaluate()
+    std::uint64_t rollouts;         // Continuations Played
+    std::uint64_t placements;       // Pieces Placed Across Every Continuation
+    double seconds;
+
+    double rolloutsPerSecond() const { return seconds > 0.0 ? rollouts / seconds : 0.0; }
+    double placementsPerSecond() const { return seconds > 0.0 ? placements / seconds : 0.0; }
+
+};
+
+
+/*
+
+    Desc: Judges Placements By Playing Them Out Instead Of By Looking At Them. Every
+    Reachable Placement Of A Piece Is Followed By rolloutCount Continuations Of
+    rolloutDepth Pieces (Any Known Upcoming Pieces First, Then A Fresh 7-Bag),
+    Placed By A RANDOM Or GREEDY Policy Under The Same Locking & Line Clearing Rules
+    As GameCore, And Scored By The Average evaluateBoard() Of Where Each Ends Up (Or
+    CONFIG::ROLLOUT_TOP_OUT_SCORE If It Tops Out). Continuation n Deals The Same
+    Pieces & Random Choices After Every Candidate, So Candidates Are Compared On
+    Equal Luck. Every Continuation Is A Task On A WorkPool, Played On Its Worker's
+    Own Scratch Board & MoveGenerator, So Evaluating Never Touches The Heap.
+
+*/
+template <unsigned int Rows, unsigned int Cols>
+class RolloutEvaluator
+{
+
+    public:
+
+        using Bits = BitBoard<Rows, Cols>;
+        using Generator = MoveGenerator<Rows, Cols>;
+
+        // Known Upcoming Pieces A Continuation Plays Before Dealing Its Own
+        static constexpr unsigned int MAX_QUEUE = 8;
+
+
+    private:
+
+        // One Worker's Playground
+        struct Scratch
+        {
+
+            Generator generator;
+            PieceStream stream;
+            Xoshiro256 rng;
+            std::uint64_t placements;
+
+        };
+
+        WorkPool pool;
+        EvalWeights weights;
+        RolloutPolicy policy;
+        unsigned int rolloutCount, rolloutDepth;
+
+        // Placements Being Judged Stay In Their Own Generator So Their Paths Survive
+        Generator rootGenerator;
+        std::vector<Scratch> scratch;                // One Per Worker
+
+        std::vector<float> outcomes;                 // rolloutCount Slots Per Placement
+        std::vector<float> scores;                   // Average Outcome Of Each Placement
+
+        // What The Current evaluate() Call Is Playing
+        const Bits* rootBoard;
+        unsigned int rootPiece;
+        unsigned int queue[MAX_QUEUE];
+        unsigned int queueLength;
+        std::uint64_t rootSeed;
+
+        RolloutStats stats;
+
+
+        /*
+
+            Desc: Picks The Placement policy Would Play Of The Placements generator Holds.
+
+            Preconditions:
+                1.) generator Holds At Least One Placement Of piece On board.
+
+            Postconditions:
+                1.) Returns The Index Of The Chosen Placement.
+
+        */
+        unsigned int pickPlacement(const Bits& board, unsigned int piece, const Generator& generator, Xoshiro256& rng) const
+        {
+
+            const unsigned int count = generator.getPlacementCount();
+            if (policy == RolloutPolicy::RANDOM) return rng.nextBelow(count);
+
+            float best = std::numeric_limits<float>::lowest();
+            unsigned int bestIndex = 0;
+            for (unsigned int i = 0; i < count; ++i) {
+                Bits child = board;
+                const unsigned int lines = applyPlacement(child, piece, generator.getPlacement(i));
+                const float score = evaluateBoard(child, lines, weights);
+                if (score > best)
+                {
+                    best = score;
+                    bestIndex = i;
+                }
+            }
+            return bestIndex;
+
+        }
+
+
+        /*
+
+            Desc: Plays One Continuation After One Candidate Placement.
+
+            Preconditions:
+                1.) task Is placement * rolloutCount + rollout; worker Is The WorkPool Worker Running It.
+
+            Postconditions:
+                1.) this->outcomes[task] Holds Where The Continuation Ended Up.
+
+        */
+        void playRollout(unsigned int task, unsigned int worker)
+        {
+
+            const unsigned int placement = task / rolloutCount;
+            const unsigned int rollout = task % rolloutCount;
+            Scratch& own = scratch[worker];
+
+            Bits board = *rootBoard;
+            unsigned int lines = applyPlacement(board, rootPiece, rootGenerator.getPlacement(placement));
+
+            // Same Luck For Continuation rollout Whichever Placement It Follows
+            own.stream.reseed(rootSeed + rollout);
+            own.rng.seed(~rootSeed - rollout);
+
+            for (unsigned int depth = 0; depth < rolloutDepth; ++depth) {
+                const unsigned int piece = depth < queueLength ? queue[depth] : own.stream.deal();
+
+                if (!own.generator.generate(board, piece))
+                {
+                    outcomes[task] = CONFIG::ROLLOUT_TOP_OUT_SCORE;
+                    own.placements += depth;
+                    return;
+                }
+
+                lines += applyPlacement(board, piece, own.generator.getPlacement(pickPlacement(board, piece, own.generator, own.rng)));
+            }
+
+            outcomes[task] = evaluateBoard(board, lines, weights);
+            own.placements += rolloutDepth;
+
+        }
+
+
+    public:
+
+        /*
+
+            Desc: Creates An Evaluator Playing newRolloutCount Continuations Of
+            newRolloutDepth Pieces After Each Placement Across threads Threads.
+
+            Preconditions:
+                1.) newRolloutCount Is At Least 1.
+
+            Postconditions:
+                1.) Every Buffer Is Allocated And The WorkPool Is Started.
+
+        */
+        explicit RolloutEvaluator(unsigned int newRolloutCount = CONFIG::ROLLOUT_COUNT, unsigned int newRolloutDepth = CONFIG::ROLLOUT_DEPTH, RolloutPolicy newPolicy = RolloutPolicy::GREEDY, unsigned int threads = std::thread::hardware_concurrency(), const EvalWeights& newWeights = DEFAULT_WEIGHTS)
+            : pool(threads), weights(newWeights), policy(newPolicy),
+            rolloutCount(newRolloutCount ? newRolloutCount : 1), rolloutDepth(newRolloutDepth),
+            scratch(pool.getThreadCount()),
+            outcomes(Generator::STATE_COUNT * rolloutCount), scores(Generator::STATE_COUNT),
+            rootBoard(nullptr), rootPiece(0), queue{}, queueLength(0), rootSeed(0), stats{}
+        {
+        }
+
+
+        /*
+
+            Desc: Scores Every Placement Of piece Reachable From (rotation, row, col)
+            By Its Average Continuation, Playing The upcomingLength Pieces Of upcoming
+            Before Dealing From seed.
+
+            Preconditions:
+                1.) upcoming Holds upcomingLength Pieces (Only The First MAX_QUEUE Are Used).
+
+            Postconditions:
+                1.) Returns How Many Placements Were Scored; getScore(i) & getPlacement(i) Describe Each.
+
+        */
+        unsigned int evaluate(const Bits& board, unsigned int piece, unsigned int rotation, unsigned int row, unsigned int col, const unsigned int* upcoming, unsigned int upcomingLength, std::uint64_t seed)
+        {
+
+            auto start = std::chrono::steady_clock::now();
+
+            const unsigned int count = rootGenerator.generate(board, piece, rotation, row, col);
+
+            rootBoard = &board;
+            rootPiece = piece;
+            queueLength = std::min(upcomingLength, MAX_QUEUE);
+            std::copy(upcoming, upcoming + queueLength, queue);
+            rootSeed = seed;
+
+            for (Scratch& own : scratch) own.placements = 0;
+            pool.parallelFor(count * rolloutCount, [this](unsigned int task, unsigned int worker) { playRollout(task, worker); });
+
+            // Average Each Placement's Continuations
+            for (unsigned int i = 0; i < count; ++i) {
+                float sum = 0.0f;
+                for (unsigned int j = 0; j < rolloutCount; ++j) {
+                    sum += outcomes[i * rolloutCount + j];
+                }
+                scores[i] = sum / rolloutCount;
+            }
+
+            stats.evaluations++;
+            stats.rollouts += std::uint64_t(count) * rolloutCount;
+            for (const Scratch& own : scratch) stats.placements += own.placements;
+            stats.seconds += std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+            return count;
+
+        }
+
+
+        /*
+
+            Desc: Scores Every Placement Of piece Reachable From Its Spawn.
+
+            Preconditions:
+                1.) Same As The Full evaluate().
+
+            Postconditions:
+                1.) Same As The Full evaluate().
+
+        */
+        unsigned int evaluate(const Bits& board, unsigned int piece, const unsigned int* upcoming, unsigned int upcomingLength, std::uint64_t seed)
+        {
+
+            return evaluate(board, piece, 0, 0, PIECE_TABLE_FOR<Cols>.get(piece, 0).spawnCol, upcoming, upcomingLength, seed);
+
+        }
+
+
+        /*
+
+            Desc: Finds The Best Scored Placement Of The Last evaluate().
+
+            Preconditions:
+                1.) None
+
+            Postconditions:
+                1.) Returns Its Index, Or -1 If There Were None.
+
+        */
+        int getBest() const
+        {
+
+            const unsigned int count = rootGenerator.getPlacementCount();
+            if (!count) return -1;
+            return static_cast<int>(std::max_element(scores.begin(), scores.begin() + count) - scores.begin());
+
+        }
+
+
+        // Getters
+        float getScore(unsigned int index) const { return scores[index]; }
+        const Placement& getPlacement(unsigned int index) const { return rootGenerator.getPlacement(index); }
+        const Generator& getGenerator() const { return rootGenerator; }
+        const RolloutStats& getStats() const { return stats; }
+        RolloutPolicy getPolicy() const { return policy; }
+        unsigned int getRolloutCount() const { return rolloutCount; }
+        unsigned int getRolloutDepth() const { return rolloutDepth; }
+        unsigned int getThreadCount() const { return pool.getThreadCount(); }
+
+};
@@ -0,0 +1,511 @@
+#include "shards.h"
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <filesystem>
+
+
+namespace
+{
+
+    constexpr std::size_t RECORD_BYTES = sizeof(TrainingRecord);
+
+
+    // What Precedes Each Block In A Shard
+    struct BlockHeader
+    {
+
+        static constexpr std::uint32_t MAGIC = 0x31425354;      // "TSB1"
+
+        std::uint32_t magic;
+        std::uint32_t records;
+        std::uint32_t bytes;        // Compressed Length Following The Header
+        std::uint32_t reserved;
+
+    };
+
+
+    std::string indexPath(const std::string& directory)
+    {
+        return directory + "/index.bin";
+    }
+
+}
+
+
+/*
+
+    Desc: Names Shard shard Of directory.
+
+    Preconditions:
+        1.) None
+
+    Postconditions:
+        1.) Returns directory/shard_NNNNNN.bin.
+
+*/
+std::string shardPath(const std::string& directory, std::uint32_t shard)
+{
+
+    char name[32];
+    std::snprintf(name, sizeof(name), "/shard_%06u.bin", static_cast<unsigned int>(shard));
+    return directory + name;
+
+}
+
+
+/*
+
+    Desc: The Most Bytes compressRecords() Can Write For count Records.
+
+    Preconditions:
+        1.) None
+
+    Postconditions:
+        1.) Returns The Bound (The Raw Size Plus One Control Byte Per 128 Bytes).
+
+*/
+std::size_t compressedBound(unsigned int count)
+{
+
+    const std::size_t raw = count * RECORD_BYTES;
+    return raw + raw / 128 + 1;
+
+}
+
+
+/*
+
+    Desc: Compresses count Records. Each Byte Is First XOR-ed With The Same Byte Of
+    The Record Before (Positions Of One Game Differ In A Few Cells), Then Zero Bytes
+    Are Run-Length Coded: A Control Byte Below 128 Is Followed By That Many Plus One
+    Literal Bytes, And One Of 128 Or More Stands For That Many Less 127 Zeros.
+
+    Preconditions:
+        1.) out Holds compressedBound(count) Bytes; Every Byte Of records Is Set (reserved Included).
+
+    Postconditions:
+        1.) Returns How Many Bytes Were Written To out.
+
+*/
+std::size_t compressRecords(const TrainingRecord* records, unsigned int count, unsigned char* out)
+{
+
+    const unsigned char* raw = reinterpret_cast<const unsigned char*>(records);
+    const std::size_t length = count * RECORD_BYTES;
+    auto delta = [raw](std::size_t i) -> unsigned char { return i < RECORD_BYTES ? raw[i] : static_cast<unsigned char>(raw[i] ^ raw[i - RECORD_BYTES]); };
+
+    std::size_t written = 0, i = 0;
+    while (i < length) {
+        if (!delta(i))
+        {
+            unsigned int run = 1;
+            while (i + run < length && run < 128 && !delta(i + run)) ++run;
+            out[written++] = static_cast<unsigned char>(127 + run);
+            i += run;
+            continue;
+        }
+
+        // Literals Run On Through Lone Zeros, Stopping At Two In A Row
+        const std::size_t control = written++;
+        unsigned int run = 0;
+        while (i < length && run < 128 && !(!delta(i) && (i + 1 >= length || !delta(i + 1)))) {
+            out[written++] = delta(i++);
+            ++run;
+        }
+        out[control] = static_cast<unsigned char>(run - 1);
+    }
+    return written;
+
+}
+
+
+/*
+
+    Desc: Undoes compressRecords().
+
+    Preconditions:
+        1.) records Holds count Records.
+
+    Postconditions:
+        1.) Returns False If in Isn't Exactly count Compressed Records.
+
+*/
+bool decompressRecords(const unsigned char* in, std::size_t bytes, TrainingRecord* records, unsigned int count)
+{
+
+    unsigned char* raw = reinterpret_cast<unsigned char*>(records);
+    const std::size_t length = count * RECORD_BYTES;
+
+    std::size_t read = 0, written = 0;
+    while (read < bytes) {
+        const unsigned int control = in[read++];
+        if (control < 128)
+        {
+            const std::size_t run = control + 1;
+            if (read + run > bytes || written + run > length) return false;
+            std::memcpy(raw + written, in + read, run);
+            read += run;
+            written += run;
+        }
+        else
+        {
+            const std::size_t run = control - 127;
+            if (written + run > length) return false;
+            std::memset(raw + written, 0, run);
+            written += run;
+        }
+    }
+    if (written != length) return false;
+
+    for (std::size_t i = RECORD_BYTES; i < length; ++i) {
+        raw[i] ^= raw[i - RECORD_BYTES];
+    }
+    return true;
+
+}
+
+
+/*
+
+    Desc: Opens newDirectory (Creating It If Needed) To Carry On After Whatever It
+    Already Holds, Allocates Every Block, And Starts The Writer Thread.
+
+    Preconditions:
+        1.) No Other Writer Has newDirectory Open.
+
+    Postconditions:
+        1.) New Records Are Numbered After Those Already Indexed, In A New Shard.
+        2.) hasFailed() Is True If The Index Couldn't Be Opened; Records Appended Are Then Dropped.
+
+*/
+ShardWriter::ShardWriter(const std::string& newDirectory)
+    : directory(newDirectory), fullHead(0), fullCount(0), filling(nullptr), stopping(false),
+    shard(0), shardBlocks(0), shardOffset(0), nextRecord(0), failed(false), stats{}
+{
+
+    std::error_code error;
+    std::filesystem::create_directories(directory, error);
+
+    // Drop Any Entry Torn By A Run That Died Mid-Write, Then Pick Up After The Last
+    const std::string path = indexPath(directory);
+    const std::uintmax_t indexBytes = std::filesystem::file_size(path, error);
+    if (!error && indexBytes >= sizeof(ShardIndexEntry))
+    {
+        const std::uintmax_t whole = indexBytes / sizeof(ShardIndexEntry) * sizeof(ShardIndexEntry);
+        if (whole != indexBytes) std::filesystem::resize_file(path, whole, error);
+
+        ShardIndexEntry last;
+        std::ifstream existing(path, std::ios::binary);
+        existing.seekg(static_cast<std::streamoff>(whole - sizeof(ShardIndexEntry)));
+        if (existing.read(reinterpret_cast<char*>(&last), sizeof(last)))
+        {
+            shard = last.shard + 1;
+            nextRecord = last.firstRecord + last.records;
+        }
+    }
+
+    indexFile.open(path, std::ios::binary | std::ios::app);
+    failed = !indexFile.is_open();
+
+    pool.reserve(CONFIG::SELFPLAY_QUEUE_BLOCKS);
+    freeBlocks.reserve(CONFIG::SELFPLAY_QUEUE_BLOCKS);
+    fullBlocks.resize(CONFIG::SELFPLAY_QUEUE_BLOCKS);
+    for (unsigned int i = 0; i < CONFIG::SELFPLAY_QUEUE_BLOCKS; ++i) {
+        pool.push_back(std::make_unique<Block>());
+        pool.back()->records = std::make_unique<TrainingRecord[]>(CONFIG::SELFPLAY_RECORDS_PER_BLOCK);
+        pool.back()->count = 0;
+        freeBlocks.push_back(pool.back().get());
+    }
+    compressed.resize(compressedBound(CONFIG::SELFPLAY_RECORDS_PER_BLOCK));
+
+    writer = std::thread(&ShardWriter::writerLoop, this);
+
+}
+
+
+/*
+
+    Desc: Writes Out Everything Appended, Then Stops The Writer Thread.
+
+    Preconditions:
+        1.) None
+
+    Postconditions:
+        1.) Same As close().
+
+*/
+ShardWriter::~ShardWriter()
+{
+
+    close();
+
+}
+
+
+/*
+
+    Desc: Copies count Records Into The Blocks Waiting To Be Written, Handing Each
+    Block To The Writer Thread As It Fills. Records Passed In One Call Stay In Order.
+
+    Preconditions:
+        1.) close() Hasn't Been Called.
+
+    Postconditions:
+        1.) The Records Will Be Written; Waits Only If Every Block Is Full And Unwritten.
+
+*/
+void ShardWriter::append(const TrainingRecord* records, unsigned int count)
+{
+
+    std::unique_lock<std::mutex> guard(lock);
+    while (count) {
+        if (!filling)
+        {
+            if (freeBlocks.empty())
+            {
+                auto start = std::chrono::steady_clock::now();
+                blockFree.wait(guard, [this] { return !freeBlocks.empty(); });
+                stats.stallSeconds += std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+            }
+            filling = freeBlocks.back();
+            freeBlocks.pop_back();
+        }
+
+        const unsigned int taken = std::min(count, CONFIG::SELFPLAY_RECORDS_PER_BLOCK - filling->count);
+        std::copy(records, records + taken, filling->records.get() + filling->count);
+        filling->count += taken;
+        records += taken;
+        count -= taken;
+
+        if (filling->count == CONFIG::SELFPLAY_RECORDS_PER_BLOCK)
+        {
+            fullBlocks[(fullHead + fullCount++) % fullBlocks.size()] = filling;
+            filling = nullptr;
+            blockReady.notify_one();
+        }
+    }
+
+}
+
+
+/*
+
+    Desc: Hands The Partly Filled Block To The Writer Thread, Waits For Every Block
+    To Be Written, And Closes The Files.
+
+    Preconditions:
+        1.) No Thread Is In append().
+
+    Postconditions:
+        1.) Every Record Appended Is On Disk And Indexed (Unless hasFailed()); Later Calls Do Nothing.
+
+*/
+void ShardWriter::close()
+{
+
+    {
+        std::lock_guard<std::mutex> guard(lock);
+        if (stopping) return;
+
+        if (filling && filling->count) fullBlocks[(fullHead + fullCount++) % fullBlocks.size()] = filling;
+        else if (filling) freeBlocks.push_back(filling);
+        filling = nullptr;
+        stopping = true;
+    }
+    blockReady.notify_one();
+    writer.join();
+
+    shardFile.close();
+    indexFile.close();
+
+}
+
+
+/*
+
+    Desc: Compresses One Block And Appends It To The Current Shard, Then Indexes It.
+
+    Preconditions:
+        1.) Called On The Writer Thread; block Holds At Least One Record.
+
+    Postconditions:
+        1.) Returns False If Either File Couldn't Be Written.
+        2.) A Shard Reaching CONFIG::SELFPLAY_BLOCKS_PER_SHARD Blocks Is Closed; The Next Block Starts A New One.
+
+*/
+bool ShardWriter::writeBlock(const Block& block)
+{
+
+    if (!shardFile.is_open())
+    {
+        shardFile.open(shardPath(directory, shard), std::ios::binary | std::ios::trunc);
+        if (!shardFile.is_open()) return false;
+        shardOffset = 0;
+        shardBlocks = 0;
+        stats.shards++;
+    }
+
+    const std::size_t bytes = compressRecords(block.records.get(), block.count, compressed.data());
+
+    const BlockHeader header{ BlockHeader::MAGIC, block.count, static_cast<std::uint32_t>(bytes), 0 };
+    shardFile.write(reinterpret_cast<const char*>(&header), sizeof(header));
+    shardFile.write(reinterpret_cast<const char*>(compressed.data()), static_cast<std::streamsize>(bytes));
+    shardFile.flush();
+    if (!shardFile) return false;
+
+    // Only Index What's Already Written, So The Index Never Points Past A Shard's End
+    const ShardIndexEntry entry{ nextRecord, shardOffset, shard, block.count };
+    indexFile.write(reinterpret_cast<const char*>(&entry), sizeof(entry));
+    indexFile.flush();
+    if (!indexFile) return false;
+
+    nextRecord += block.count;
+    shardOffset += sizeof(header) + bytes;
+    stats.records += block.count;
+    stats.blocks++;
+    stats.rawBytes += block.count * RECORD_BYTES;
+    stats.compressedBytes += sizeof(header) + bytes;
+
+    if (++shardBlocks == CONFIG::SELFPLAY_BLOCKS_PER_SHARD)
+    {
+        shardFile.close();
+        shard++;
+    }
+    return true;
+
+}
+
+
+/*
+
+    Desc: The Writer Thread: Writes Full Blocks As They Come, Returning Each To The
+    Free Blocks, Until Stopped With Nothing Left To Write.
+
+    Preconditions:
+        1.) None
+
+    Postconditions:
+        1.) Every Block Handed Over Before close() Was Written (Or Dropped, Once Writing Has Failed).
+
+*/
+void ShardWriter::writerLoop()
+{
+
+    for (;;) {
+        Block* block;
+        {
+            std::unique_lock<std::mutex> guard(lock);
+            blockReady.wait(guard, [this] { return stopping || fullCount; });
+            if (!fullCount) return;
+
+            block = fullBlocks[fullHead];
+            fullHead = (fullHead + 1) % fullBlocks.size();
+            fullCount--;
+        }
+
+        if (!failed && !writeBlock(*block)) failed = true;
+
+        {
+            std::lock_guard<std::mutex> guard(lock);
+            block->count = 0;
+            freeBlocks.push_back(block);
+        }
+        blockFree.notify_one();
+    }
+
+}
+
+
+ShardReader::ShardReader()
+    : entries(nullptr), entryCount(0), recordCount(0), openShard(0), cachedEntry(SIZE_MAX)
+{
+}
+
+
+/*
+
+    Desc: Maps The Index Of newDirectory.
+
+    Preconditions:
+        1.) No ShardWriter Is Writing To newDirectory.
+
+    Postconditions:
+        1.) Returns False If It Has No Index (Or An Empty One).
+        2.) Otherwise Records 0 To getRecordCount() - 1 Can Be read().
+
+*/
+bool ShardReader::open(const std::string& newDirectory)
+{
+
+    directory = newDirectory;
+    shardFile.close();
+    cachedEntry = SIZE_MAX;
+    entries = nullptr;
+    entryCount = 0;
+    recordCount = 0;
+
+    if (!index.open(indexPath(directory))) return false;
+
+    entries = reinterpret_cast<const ShardIndexEntry*>(index.getData());
+    entryCount = index.getSize() / sizeof(ShardIndexEntry);
+    if (!entryCount) return false;
+
+    recordCount = entries[entryCount - 1].firstRecord + entries[entryCount - 1].records;
+    if (!block) block = std::make_unique<TrainingRecord[]>(CONFIG::SELFPLAY_RECORDS_PER_BLOCK);
+    return true;
+
+}
+
+
+/*
+
+    Desc: Reads Record Number record, Finding Its Block By Binary Search Of The Index.
+
+    Preconditions:
+        1.) open() Succeeded.
+
+    Postconditions:
+        1.) Returns False If record Is Out Of Range Or Its Block Can't Be Read.
+        2.) Otherwise out Is The Record; Its Block Stays Cached For The Next Read.
+
+*/
+bool ShardReader::read(std::uint64_t record, TrainingRecord& out)
+{
+
+    if (record >= recordCount || record < entries[0].firstRecord) return false;
+
+    if (cachedEntry == SIZE_MAX || record < entries[cachedEntry].firstRecord || record >= entries[cachedEntry].firstRecord + entries[cachedEntry].records)
+    {
+        // Last Block Starting At Or Before record
+        const ShardIndexEntry* found = std::upper_bound(entries, entries + entryCount, record,
+            [](std::uint64_t value, const ShardIndexEntry& entry) { return value < entry.firstRecord; }) - 1;
+        cachedEntry = SIZE_MAX;
+        if (found->records > CONFIG::SELFPLAY_RECORDS_PER_BLOCK) return false;
+
+        if (!shardFile.is_open() || openShard != found->shard)
+        {
+            shardFile.close();
+            shardFile.clear();
+            shardFile.open(shardPath(directory, found->shard), std::ios::binary);
+            openShard = found->shard;
+        }
+
+        BlockHeader header;
+        shardFile.clear();
+        shardFile.seekg(static_cast<std::streamoff>(found->offset));
+        if (!shardFile.read(reinterpret_cast<char*>(&header), sizeof(header))) return false;
+        if (header.magic != BlockHeader::MAGIC || header.records != found->records || header.bytes > compressedBound(header.records)) return false;
+
+        compressed.resize(header.bytes);
+        if (!shardFile.read(reinterpret_cast<char*>(compressed.data()), header.bytes)) return false;
+        if (!decompressRecords(compressed.data(), header.bytes, block.get(), header.records)) return false;
+
+        cachedEntry = static_cast<std::size_t>(found - entries);
+    }
+
+    out = block[record - entries[cachedEntry].firstRecord];
+    return true;
+
+}
@@ -0,0 +1,193 @@
+#pragma once
+
+
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <fstream>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+#include "mappedfile.h"
+#include "config.h"
+
+
+
+/*
+
+    Desc: One Position Of Self-Play: The Locked Cells, The Piece To Place, Where The
+    Policy Put It, And How The Game Went From There.
+
+*/
+struct TrainingRecord
+{
+
+    std::uint16_t rows[CONFIG::BOARD_ROWS];     // Locked Cells Before The Placement, Top Row First (Bit c Is Column c)
+    std::uint8_t piece;
+    std::uint8_t rotation, row, col;            // Placement Chosen
+    std::uint32_t linesAfter;                   // Lines Cleared From Here To The End Of The Game
+    std::uint32_t piecesAfter;                  // Pieces Locked From Here To The End Of The Game, This One Included
+    std::uint8_t toppedOut;                     // 1 If The Game Ended By Topping Out, 0 If It Was Cut Short
+    std::uint8_t explored;                      // 1 If The Placement Was Picked At Random Instead Of By The Policy
+    std::uint8_t reserved[2];
+
+};
+
+static_assert(CONFIG::BOARD_COLS <= 16, "Records Keep Each Row In 16 Bits");
+
+
+/*
+
+    Desc: One Entry Of A Shard Directory's index.bin, One Per Block Written. Entries
+    Are Appended In Record Order, So A Record Is Found By Binary Search On firstRecord.
+
+*/
+struct ShardIndexEntry
+{
+
+    std::uint64_t firstRecord;      // Number Of The Block's First Record Across The Whole Directory
+    std::uint64_t offset;           // Where The Block's Header Starts In Its Shard
+    std::uint32_t shard;
+    std::uint32_t records;
+
+};
+
+static_assert(sizeof(ShardIndexEntry) == 24, "Index Entries Are Read Straight From The Mapped File");
+
+
+/*
+
+    Desc: Totals Of What A ShardWriter Has Written.
+
+*/
+struct ShardStats
+{
+
+    std::uint64_t records, blocks, shards;
+    std::uint64_t rawBytes, compressedBytes;
+    double stallSeconds;            // Time append() Spent Waiting For A Free Block
+
+    double compressionRatio() const { return compressedBytes ? static_cast<double>(rawBytes) / compressedBytes : 0.0; }
+
+};
+
+
+std::string shardPath(const std::string& directory, std::uint32_t shard);
+std::size_t compressedBound(unsigned int count);
+std::size_t compressRecords(const TrainingRecord* records, unsigned int count, unsigned char* out);
+bool decompressRecords(const unsigned char* in, std::size_t bytes, TrainingRecord* records, unsigned int count);
+
+
+/*
+
+    Desc: Streams TrainingRecords Into A Directory Of Append-Only Shard Files From Any
+    Number Of Threads. append() Only Copies Records Into The Block Being Filled;
+    Full Blocks Go To A Thread Of The Writer's Own, Which Compresses Each (XOR With
+    The Previous Record, Then Run-Length Coding Of Zero Bytes) And Appends It To
+    The Current Shard, Then Appends Its ShardIndexEntry To index.bin Once The Block
+    Is On Disk. Every Shard Holds CONFIG::SELFPLAY_BLOCKS_PER_SHARD Blocks (The
+    Last May Be Short). Blocks Come From A Pool Allocated Up Front, So Steady
+    Writing Never Touches The Heap, And Only A Writer Falling A Whole Pool Behind
+    Makes append() Wait. Reopening A Directory Carries On After Its Last Shard.
+
+*/
+class ShardWriter
+{
+
+    private:
+
+        struct Block
+        {
+
+            std::unique_ptr<TrainingRecord[]> records;
+            unsigned int count;
+
+        };
+
+        std::string directory;
+
+        // Handing Blocks Between append() And The Writer Thread
+        std::mutex lock;
+        std::condition_variable blockReady, blockFree;
+        std::vector<std::unique_ptr<Block>> pool;
+        std::vector<Block*> freeBlocks;
+        std::vector<Block*> fullBlocks;        // Ring Of Blocks Waiting To Be Written, Oldest At fullHead
+        std::size_t fullHead, fullCount;
+        Block* filling;
+        bool stopping;
+
+        // Writer Thread's Own State
+        std::ofstream shardFile, indexFile;
+        std::uint32_t shard;
+        unsigned int shardBlocks;
+        std::uint64_t shardOffset, nextRecord;
+        std::vector<unsigned char> compressed;
+        bool failed;
+
+        ShardStats stats;
+        std::thread writer;
+
+
+        bool writeBlock(const Block& block);
+        void writerLoop();
+
+
+    public:
+
+        explicit ShardWriter(const std::string& newDirectory);
+        ~ShardWriter();
+
+        ShardWriter(const ShardWriter&) = delete;
+        ShardWriter& operator=(const ShardWriter&) = delete;
+
+        void append(const TrainingRecord* records, unsigned int count);
+        void close();
+
+        // Getters (Only Settled Once close() Returns)
+        const ShardStats& getStats() const { return stats; }
+        bool hasFailed() const { return failed; }
+
+};
+
+
+/*
+
+    Desc: Reads Any Record Of A Shard Directory By Number, For Sampling Training
+    Data At Random. index.bin Is Memory Mapped And Binary Searched, So Finding A
+    Record's Block Is O(log Blocks) With Nothing Parsed Up Front; The Block Is Then
+    Read And Decompressed, And Kept In Case The Next Record Is In It Too.
+
+*/
+class ShardReader
+{
+
+    private:
+
+        std::string directory;
+        MappedFile index;
+        const ShardIndexEntry* entries;
+        std::size_t entryCount;
+        std::uint64_t recordCount;
+
+        // Last Block Read
+        std::ifstream shardFile;
+        std::uint32_t openShard;
+        std::size_t cachedEntry;
+        std::vector<unsigned char> compressed;
+        std::unique_ptr<TrainingRecord[]> block;
+
+
+    public:
+
+        ShardReader();
+
+        bool open(const std::string& newDirectory);
+        bool read(std::uint64_t record, TrainingRecord& out);
+
+        // Getters
+        std::uint64_t getRecordCount() const { return recordCount; }
+        std::size_t getBlockCount() const { return entryCount; }
+
+};
@@ -0,0 +1,123 @@
+#pragma once
+
+
+#include <cstdint>
+#include <type_traits>
+
+#if defined(__AVX2__)
+#include <immintrin.h>
+#define TETRIS_SIMD_AVX2 1
+#endif
+
+#if defined(__SSE2__) || defined(_M_X64) || defined(_M_AMD64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#include <emmintrin.h>
+#define TETRIS_SIMD_SSE2 1
+#endif
+
+
+
+/*
+
+    Desc: The Handful Of Operations On Packed 16-Bit Lanes Our Batched Boards Need,
+    Once Per Instruction Set. Each Flavour Exposes The Same Static Functions Over Its
+    Own Reg Type And Handles WIDTH Lanes At A Time; Comparisons Yield All-Ones Lanes
+    For True, And laneBits Packs Those Into One Bit Per Lane. Which Flavours Exist Is
+    Decided At Compile Time By The Target's Instruction Set (/arch:AVX2, -mavx2, ...);
+    The Solution's ReleaseAVX2|x64 Configuration Builds Everything With /arch:AVX2,
+    While The Others Stop At SSE2 So Their Binaries Run On Any x64 CPU.
+
+*/
+namespace SIMD
+{
+
+    // One Lane At A Time, For Targets Without SSE2
+    struct Scalar
+    {
+
+        using Reg = std::uint16_t;
+        static constexpr unsigned int WIDTH = 1;
+
+        static Reg load(const std::uint16_t* p) { return *p; }
+        static void store(std::uint16_t* p, Reg v) { *p = v; }
+        static Reg zero() { return 0; }
+        static Reg splat(std::uint16_t v) { return v; }
+        static Reg bitAnd(Reg a, Reg b) { return static_cast<Reg>(a & b); }
+        static Reg bitOr(Reg a, Reg b) { return static_cast<Reg>(a | b); }
+        static Reg andNot(Reg mask, Reg a) { return static_cast<Reg>(a & ~mask); }
+        static Reg equal(Reg a, Reg b) { return static_cast<Reg>(a == b ? 0xFFFFu : 0u); }
+        static Reg select(Reg mask, Reg a, Reg b) { return static_cast<Reg>((a & ~mask) | (b & mask)); }
+        static std::uint32_t laneBits(Reg mask) { return mask & 1u; }
+
+    };
+
+
+#ifdef TETRIS_SIMD_SSE2
+
+    // Eight Lanes Per 128-Bit Register
+    struct SSE2
+    {
+
+        using Reg = __m128i;
+        static constexpr unsigned int WIDTH = 8;
+
+        static Reg load(const std::uint16_t* p) { return _mm_load_si128(reinterpret_cast<const __m128i*>(p)); }
+        static void store(std::uint16_t* p, Reg v) { _mm_store_si128(reinterpret_cast<__m128i*>(p), v); }
+        static Reg zero() { return _mm_setzero_si128(); }
+        static Reg splat(std::uint16_t v) { return _mm_set1_epi16(static_cast<short>(v)); }
+        static Reg bitAnd(Reg a, Reg b) { return _mm_and_si128(a, b); }
+        static Reg bitOr(Reg a, Reg b) { return _mm_or_si128(a, b); }
+        static Reg andNot(Reg mask, Reg a) { return _mm_andnot_si128(mask, a); }
+        static Reg equal(Reg a, Reg b) { return _mm_cmpeq_epi16(a, b); }
+        static Reg select(Reg mask, Reg a, Reg b) { return _mm_or_si128(_mm_andnot_si128(mask, a), _mm_and_si128(mask, b)); }
+        static std::uint32_t laneBits(Reg mask) { return static_cast<std::uint32_t>(_mm_movemask_epi8(_mm_packs_epi16(mask, _mm_setzero_si128()))); }
+
+    };
+
+#endif
+
+
+#ifdef TETRIS_SIMD_AVX2
+
+    // Sixteen Lanes Per 256-Bit Register
+    struct AVX2
+    {
+
+        using Reg = __m256i;
+        static constexpr unsigned int WIDTH = 16;
+
+        static Reg load(const std::uint16_t* p) { return _mm256_load_si256(reinterpret_cast<const __m256i*>(p)); }
+        static void store(std::uint16_t* p, Reg v) { _mm256_store_si256(reinterpret_cast<__m256i*>(p), v); }
+        static Reg zero() { return _mm256_setzero_si256(); }
+        static Reg splat(std::uint16_t v) { return _mm256_set1_epi16(static_cast<short>(v)); }
+        static Reg bitAnd(Reg a, Reg b) { return _mm256_and_si256(a, b); }
+        static Reg bitOr(Reg a, Reg b) { return _mm256_or_si256(a, b); }
+        static Reg andNot(Reg mask, Reg a) { return _mm256_andnot_si256(mask, a); }
+        static Reg equal(Reg a, Reg b) { return _mm256_cmpeq_epi16(a, b); }
+        static Reg select(Reg mask, Reg a, Reg b) { return _mm256_blendv_epi8(a, b, mask); }
+
+        static std::uint32_t laneBits(Reg mask)
+        {
+            // Packing Works Within Each 128-Bit Half, Leaving Lanes 0-7 In Bits 0-7 And 8-15 In Bits 16-23
+            std::uint32_t bytes = static_cast<std::uint32_t>(_mm256_movemask_epi8(_mm256_packs_epi16(mask, _mm256_setzero_si256())));
+            return (bytes & 0xFFu) | ((bytes >> 8) & 0xFF00u);
+        }
+
+    };
+
+#endif
+
+
+    // Widest Flavour Evenly Covering Lanes Lanes
+    template <unsigned int Lanes>
+    struct WidestFor
+    {
+#if defined(TETRIS_SIMD_AVX2)
+        using Type = std::conditional_t<Lanes % AVX2::WIDTH == 0, AVX2, std::conditional_t<Lanes % SSE2::WIDTH == 0, SSE2, Scalar>>;
+#elif defined(TETRIS_SIMD_SSE2)
+        using Type = std::conditional_t<Lanes % SSE2::WIDTH == 0, SSE2, Scalar>;
+#else
+        using Type = Scalar;
+#endif
+    };
+
+}
@@ -0,0 +1,317 @@
+#include "transtable.h"
+#include <cstring>
+#include <initializer_list>
+#include <new>
+
+#ifdef _WIN32
+#define NOMINMAX
+#include <windows.h>
+#else
+#include <sys/mman.h>
+#endif
+
+
+namespace
+{
+
+    /*
+
+        Desc: Asks For bytes Of Zeroed Memory, On Huge Pages If The System Will Give
+        Them. Windows Only Hands Out Large Pages To Processes Holding The Lock Pages
+        In Memory Privilege, So It Tries To Switch That On First; Elsewhere Explicit
+        Huge Pages Are Tried Before Falling Back To Asking For Transparent Ones.
+
+        Preconditions:
+            1.) bytes Is Not 0.
+
+        Postconditions:
+            1.) Returns The Memory (nullptr If None Was Available).
+            2.) mapped Is How Much Was Actually Mapped; huge Is Set If It's On Huge Pages.
+
+    */
+    void* mapMemory(std::size_t bytes, std::size_t& mapped, bool& huge)
+    {
+
+        huge = false;
+        mapped = bytes;
+
+#ifdef _WIN32
+        HANDLE token;
+        if (OpenProcessToken(GetCurrentProcess(), TOKEN_ADJUST_PRIVILEGES | TOKEN_QUERY, &token))
+        {
+            TOKEN_PRIVILEGES privileges{};
+            privileges.PrivilegeCount = 1;
+            privileges.Privileges[0].Attributes = SE_PRIVILEGE_ENABLED;
+            if (LookupPrivilegeValue(nullptr, SE_LOCK_MEMORY_NAME, &privileges.Privileges[0].Luid))
+            {
+                AdjustTokenPrivileges(token, FALSE, &privileges, 0, nullptr, nullptr);
+            }
+            CloseHandle(token);
+        }
+
+        const SIZE_T largePage = GetLargePageMinimum();
+        if (largePage)
+        {
+            const std::size_t rounded = (bytes + largePage - 1) / largePage * largePage;
+            void* memory = VirtualAlloc(nullptr, rounded, MEM_RESERVE | MEM_COMMIT | MEM_LARGE_PAGES, PAGE_READWRITE);
+            if (memory)
+            {
+                huge = true;
+                mapped = rounded;
+                return memory;
+            }
+        }
+
+        return VirtualAlloc(nullptr, bytes, MEM_RESERVE | MEM_COMMIT, PAGE_READWRITE);
+#else
+        constexpr std::size_t HUGE_PAGE = 2 * 1024 * 1024;
+
+#ifdef MAP_HUGETLB
+        const std::size_t rounded = (bytes + HUGE_PAGE - 1) / HUGE_PAGE * HUGE_PAGE;
+        void* memory = mmap(nullptr, rounded, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB, -1, 0);
+        if (memory != MAP_FAILED)
+        {
+            huge = true;
+            mapped = rounded;
+            return memory;
+        }
+#endif
+
+        void* fallback = mmap(nullptr, bytes, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+        if (fallback == MAP_FAILED) return nullptr;
+
+#ifdef MADV_HUGEPAGE
+        madvise(fallback, bytes, MADV_HUGEPAGE);
+#endif
+        return fallback;
+#endif
+
+    }
+
+
+    void unmapMemory(void* memory, std::size_t mapped)
+    {
+
+#ifdef _WIN32
+        (void)mapped;
+        VirtualFree(memory, 0, MEM_RELEASE);
+#else
+        munmap(memory, mapped);
+#endif
+
+    }
+
+}
+
+
+/*
+
+    Desc: Maps The Largest Power-Of-Two Count Of Buckets Fitting In megabytes.
+
+    Preconditions:
+        1.) None
+
+    Postconditions:
+        1.) The Table Is Empty With At Least One Bucket.
+        2.) Throws std::bad_alloc If No Memory Could Be Mapped.
+
+*/
+TranspositionTable::TranspositionTable(std::size_t megabytes)
+    : buckets(nullptr), bucketCount(1), mappedBytes(0), hugePages(false), searchAge(0)
+{
+
+    const std::size_t bytes = megabytes * 1024 * 1024;
+    while (bucketCount * 2 * sizeof(Bucket) <= bytes) bucketCount *= 2;
+
+    void* memory = mapMemory(bucketCount * sizeof(Bucket), mappedBytes, hugePages);
+    if (!memory) throw std::bad_alloc();
+
+    buckets = static_cast<Bucket*>(memory);
+    for (std::size_t i = 0; i < bucketCount; ++i) {
+        new (&buckets[i]) Bucket();
+    }
+    clear();
+
+}
+
+
+/*
+
+    Desc: Unmaps The Table.
+
+    Preconditions:
+        1.) No Thread Is Using The Table.
+
+    Postconditions:
+        1.) The Table's Memory Is Returned To The System.
+
+*/
+TranspositionTable::~TranspositionTable()
+{
+
+    unmapMemory(buckets, mappedBytes);
+
+}
+
+
+/*
+
+    Desc: Packs An Entry Into One Word: The Score's Bits Low, Then The Placement's
+    Row, Column, And Rotation, The Depth, And The Search Age On Top.
+
+    Preconditions:
+        1.) depth Is Between 1 And 63.
+
+    Postconditions:
+        1.) Returns The Packed Word (Never 0, As depth Is At Least 1).
+
+*/
+std::uint64_t TranspositionTable::pack(float score, const Placement& best, unsigned int depth, std::uint8_t age)
+{
+
+    std::uint32_t scoreBits;
+    std::memcpy(&scoreBits, &score, sizeof(scoreBits));
+
+    return std::uint64_t(scoreBits)
+        | (std::uint64_t(best.row) << 32)
+        | (std::uint64_t(best.col) << 40)
+        | (std::uint64_t(best.rotation & 0x3u) << 48)
+        | (std::uint64_t(depth & 0x3Fu) << 50)
+        | (std::uint64_t(age) << 56);
+
+}
+
+
+/*
+
+    Desc: Reads An Entry, Checking It Belongs To key And Wasn't Torn Mid-Write.
+
+    Preconditions:
+        1.) None
+
+    Postconditions:
+        1.) Returns True And Sets data If The Entry Holds key.
+
+*/
+bool TranspositionTable::matches(const Entry& entry, std::uint64_t key, std::uint64_t& data)
+{
+
+    data = entry.data.load(std::memory_order_relaxed);
+    return data && (entry.check.load(std::memory_order_relaxed) ^ data) == key;
+
+}
+
+
+/*
+
+    Desc: Looks key Up In Its Bucket.
+
+    Preconditions:
+        1.) None
+
+    Postconditions:
+        1.) Returns True And Fills hit If Either Entry Of The Bucket Holds key.
+        2.) The Probe (And Hit) Counters Are Bumped.
+
+*/
+bool TranspositionTable::probe(std::uint64_t key, TableHit& hit) const
+{
+
+    counters.probes.fetch_add(1, std::memory_order_relaxed);
+
+    const Bucket& bucket = buckets[key & (bucketCount - 1)];
+    std::uint64_t data;
+    if (!matches(bucket.depthPreferred, key, data) && !matches(bucket.alwaysReplace, key, data)) return false;
+
+    std::uint32_t scoreBits = static_cast<std::uint32_t>(data);
+    std::memcpy(&hit.score, &scoreBits, sizeof(scoreBits));
+    hit.best.row = static_cast<std::uint8_t>(data >> 32);
+    hit.best.col = static_cast<std::uint8_t>(data >> 40);
+    hit.best.rotation = static_cast<std::uint8_t>((data >> 48) & 0x3u);
+    hit.depth = static_cast<unsigned int>((data >> 50) & 0x3Fu);
+    hit.current = static_cast<std::uint8_t>(data >> 56) == searchAge;
+
+    counters.hits.fetch_add(1, std::memory_order_relaxed);
+    return true;
+
+}
+
+
+/*
+
+    Desc: Remembers A Searched Position. It Takes The Depth-Preferred Entry If That
+    Holds Nothing As Deep, Holds The Same Position, Or Is Left From An Older Search;
+    Otherwise It Overwrites The Always-Replace Entry.
+
+    Preconditions:
+        1.) depth Is Between 1 And 63.
+
+    Postconditions:
+        1.) key Maps To The Given Score, Placement, And Depth (Until Replaced).
+
+*/
+void TranspositionTable::store(std::uint64_t key, float score, const Placement& best, unsigned int depth)
+{
+
+    counters.stores.fetch_add(1, std::memory_order_relaxed);
+
+    Bucket& bucket = buckets[key & (bucketCount - 1)];
+    const std::uint64_t data = pack(score, best, depth, searchAge);
+
+    const std::uint64_t held = bucket.depthPreferred.data.load(std::memory_order_relaxed);
+    const unsigned int heldDepth = static_cast<unsigned int>((held >> 50) & 0x3Fu);
+    const std::uint8_t heldAge = static_cast<std::uint8_t>(held >> 56);
+    const bool samePosition = (bucket.depthPreferred.check.load(std::memory_order_relaxed) ^ held) == key;
+
+    Entry& entry = (!held || samePosition || depth >= heldDepth || heldAge != searchAge) ? bucket.depthPreferred : bucket.alwaysReplace;
+    entry.check.store(key ^ data, std::memory_order_relaxed);
+    entry.data.store(data, std::memory_order_relaxed);
+
+}
+
+
+/*
+
+    Desc: Starts A New Search, Letting Deep Entries Of Earlier Searches Be Replaced.
+
+    Preconditions:
+        1.) None
+
+    Postconditions:
+        1.) Stores From Now On Are Tagged With A New Age.
+
+*/
+void TranspositionTable::newSearch()
+{
+
+    searchAge++;
+
+}
+
+
+/*
+
+    Desc: Empties Every Entry And Resets The Counters.
+
+    Preconditions:
+        1.) No Other Thread Is Using The Table.
+
+    Postconditions:
+        1.) Every Probe Misses Until Something Is Stored.
+
+*/
+void TranspositionTable::clear()
+{
+
+    for (std::size_t i = 0; i < bucketCount; ++i) {
+        for (Entry* entry : { &buckets[i].depthPreferred, &buckets[i].alwaysReplace }) {
+            entry->check.store(0, std::memory_order_relaxed);
+            entry->data.store(0, std::memory_order_relaxed);
+        }
+    }
+
+    counters.probes.store(0, std::memory_order_relaxed);
+    counters.hits.store(0, std::memory_order_relaxed);
+    counters.stores.store(0, std::memory_order_relaxed);
+
+}
@@ -0,0 +1,106 @@
+#pragma once
+
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include "movegen.h"
+#include "config.h"
+
+
+
+/*
+
+    Desc: What A TranspositionTable Remembers About A Position.
+
+*/
+struct TableHit
+{
+
+    float score;            // Evaluation Of The Position
+    Placement best;         // Placement That Scored It
+    unsigned int depth;     // Pieces Searched Below The Position To Get score
+    bool current;           // Stored Since The Last newSearch()
+
+};
+
+
+/*
+
+    Desc: A Fixed-Size Hash Table Of Searched Positions, Shared By Every Search Thread
+    Without Any Locks. Each Entry Is Two 64-Bit Words: The Packed Data And The Key
+    XOR-ed With It. A Reader Rebuilds The Key From Both, So An Entry Torn By Two
+    Threads Writing At Once Simply Fails To Match Instead Of Returning Bad Data.
+    Buckets Hold A Depth-Preferred Entry, Only Replaced By Searches At Least As
+    Deep (Or Left From An Older Search), And An Always-Replace Entry Catching The
+    Rest. The Table Is Sized In Megabytes When Made And Sits On Huge Pages When
+    The System Grants Them.
+
+*/
+class TranspositionTable
+{
+
+    private:
+
+        struct Entry
+        {
+
+            std::atomic<std::uint64_t> check;   // Key ^ data
+            std::atomic<std::uint64_t> data;
+
+        };
+
+        // Two Buckets Per Cache Line
+        struct alignas(32) Bucket
+        {
+
+            Entry depthPreferred;
+            Entry alwaysReplace;
+
+        };
+
+        // Probe Counters, Off On Their Own Cache Line
+        struct alignas(CONFIG::CACHE_LINE_BYTES) Counters
+        {
+
+            std::atomic<std::uint64_t> probes{ 0 };
+            std::atomic<std::uint64_t> hits{ 0 };
+            std::atomic<std::uint64_t> stores{ 0 };
+
+        };
+
+        Bucket* buckets;
+        std::size_t bucketCount;            // Power Of Two
+        std::size_t mappedBytes;
+        bool hugePages;
+        std::uint8_t searchAge;             // Bumped Each Search So Old Deep Entries Give Way
+        mutable Counters counters;
+
+
+        static std::uint64_t pack(float score, const Placement& best, unsigned int depth, std::uint8_t age);
+        static bool matches(const Entry& entry, std::uint64_t key, std::uint64_t& data);
+
+
+    public:
+
+        explicit TranspositionTable(std::size_t megabytes = CONFIG::BOT_TABLE_MB);
+        ~TranspositionTable();
+
+        TranspositionTable(const TranspositionTable&) = delete;
+        TranspositionTable& operator=(const TranspositionTable&) = delete;
+
+        bool probe(std::uint64_t key, TableHit& hit) const;
+        void store(std::uint64_t key, float score, const Placement& best, unsigned int depth);
+        void newSearch();
+        void clear();
+
+        // Getters
+        std::uint64_t getProbes() const { return counters.probes.load(std::memory_order_relaxed); }
+        std::uint64_t getHits() const { return counters.hits.load(std::memory_order_relaxed); }
+        std::uint64_t getStores() const { return counters.stores.load(std::memory_order_relaxed); }
+        double getHitRate() const { return getProbes() ? static_cast<double>(getHits()) / getProbes() : 0.0; }
+        std::size_t getBucketCount() const { return bucketCount; }
+        std::size_t getSizeBytes() const { return bucketCount * sizeof(Bucket); }
+        bool usesHugePages() const { return hugePages; }
+
+};
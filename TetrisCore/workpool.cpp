@@ -0,0 +1,223 @@
+#include "workpool.h"
+
+
+/*
+
+    Desc: Starts threads - 1 Worker Threads; The Caller Of parallelFor Is The Last.
+
+    Preconditions:
+        1.) None
+
+    Postconditions:
+        1.) The Pool Is Idle With At Least One Worker (A Count Of 0 Means 1).
+
+*/
+WorkPool::WorkPool(unsigned int threads)
+    : threadCount(threads ? threads : 1), ranges(new TaskRange[threadCount]),
+    job(nullptr), jobGeneration(0), busyThreads(0), stopping(false)
+{
+
+    this->threads.reserve(threadCount - 1);
+    for (unsigned int worker = 1; worker < threadCount; ++worker) {
+        this->threads.emplace_back(&WorkPool::threadLoop, this, worker);
+    }
+
+}
+
+
+/*
+
+    Desc: Stops And Joins Every Worker Thread.
+
+    Preconditions:
+        1.) No parallelFor Is Running.
+
+    Postconditions:
+        1.) Every Worker Thread Has Exited.
+
+*/
+WorkPool::~WorkPool()
+{
+
+    {
+        std::lock_guard<std::mutex> guard(jobLock);
+        stopping = true;
+    }
+    jobReady.notify_all();
+
+    for (std::thread& thread : threads) {
+        thread.join();
+    }
+
+}
+
+
+/*
+
+    Desc: Takes The Next Task From worker's Own Range.
+
+    Preconditions:
+        1.) worker Is In [0, threadCount).
+
+    Postconditions:
+        1.) Returns True And Sets task If worker Had A Task Left.
+
+*/
+bool WorkPool::popTask(unsigned int worker, unsigned int& task)
+{
+
+    TaskRange& range = ranges[worker];
+    std::lock_guard<std::mutex> guard(range.lock);
+
+    if (range.begin == range.end) return false;
+    task = range.begin++;
+    return true;
+
+}
+
+
+/*
+
+    Desc: Moves The Upper Half Of Some Other Worker's Remaining Tasks Into worker's
+    (Empty) Range, Trying Each Victim In Turn Starting After worker.
+
+    Preconditions:
+        1.) worker's Own Range Is Empty.
+
+    Postconditions:
+        1.) Returns True If Any Tasks Were Stolen Into worker's Range.
+        2.) Returns False If Every Other Range Was Empty.
+
+*/
+bool WorkPool::stealTasks(unsigned int worker)
+{
+
+    for (unsigned int i = 1; i < threadCount; ++i) {
+        TaskRange& victim = ranges[(worker + i) % threadCount];
+        unsigned int begin, end;
+
+        {
+            std::lock_guard<std::mutex> guard(victim.lock);
+            if (victim.begin == victim.end) continue;
+
+            // Leave The Victim The Lower Half (Rounded Down), Take The Rest
+            begin = victim.begin + (victim.end - victim.begin) / 2;
+            end = victim.end;
+            victim.end = begin;
+        }
+
+        TaskRange& own = ranges[worker];
+        std::lock_guard<std::mutex> guard(own.lock);
+        own.begin = begin;
+        own.end = end;
+        return true;
+    }
+
+    return false;
+
+}
+
+
+/*
+
+    Desc: Runs Tasks Of The Current Job On worker Until There Are None Left To Run
+    Or Steal.
+
+    Preconditions:
+        1.) This->job Is Set.
+
+    Postconditions:
+        1.) worker's Range Is Empty And No Other Range Had Tasks To Steal.
+
+*/
+void WorkPool::runTasks(unsigned int worker)
+{
+
+    unsigned int task;
+    do {
+        while (popTask(worker, task)) {
+            (*job)(task, worker);
+        }
+    } while (stealTasks(worker));
+
+}
+
+
+/*
+
+    Desc: Body Of Each Worker Thread; Waits For A New Job, Helps Run It, And Reports
+    Back When It Finds No More Work.
+
+    Preconditions:
+        1.) worker Is In [1, threadCount).
+
+    Postconditions:
+        1.) Returns Once The Pool Is Stopping.
+
+*/
+void WorkPool::threadLoop(unsigned int worker)
+{
+
+    unsigned int seenGeneration = 0;
+
+    while (true) {
+        {
+            std::unique_lock<std::mutex> guard(jobLock);
+            jobReady.wait(guard, [&] { return stopping || jobGeneration != seenGeneration; });
+            if (stopping) return;
+            seenGeneration = jobGeneration;
+        }
+
+        runTasks(worker);
+
+        {
+            std::lock_guard<std::mutex> guard(jobLock);
+            busyThreads--;
+        }
+        jobDone.notify_one();
+    }
+
+}
+
+
+/*
+
+    Desc: Runs body For Every Task In [0, count) Across The Pool, Blocking Until
+    All Of Them Have Finished.
+
+    Preconditions:
+        1.) body Is Safe To Call Concurrently For Different Tasks.
+        2.) Not Called From Inside Another parallelFor's body.
+
+    Postconditions:
+        1.) body Has Run Exactly Once For Every Task.
+
+*/
+void WorkPool::parallelFor(unsigned int count, const TaskBody& body)
+{
+
+    if (!count) return;
+
+    // Deal Out Even Shares Before Anyone Starts
+    for (unsigned int worker = 0; worker < threadCount; ++worker) {
+        TaskRange& range = ranges[worker];
+        std::lock_guard<std::mutex> guard(range.lock);
+        range.begin = static_cast<unsigned int>(static_cast<unsigned long long>(count) * worker / threadCount);
+        range.end = static_cast<unsigned int>(static_cast<unsigned long long>(count) * (worker + 1) / threadCount);
+    }
+
+    {
+        std::lock_guard<std::mutex> guard(jobLock);
+        job = &body;
+        busyThreads = threadCount - 1;
+        jobGeneration++;
+    }
+    jobReady.notify_all();
+
+    runTasks(0);
+
+    std::unique_lock<std::mutex> guard(jobLock);
+    jobDone.wait(guard, [&] { return busyThreads == 0; });
+    job = nullptr;
+
+}
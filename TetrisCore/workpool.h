@@ -0,0 +1,75 @@
+#pragma once
+
+
+#include <condition_variable>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+#include "config.h"
+
+
+
+/*
+
+    Desc: A Fixed Set Of Worker Threads That Run parallelFor Jobs By Work Stealing.
+    Each Worker Starts With An Even Share Of The Task Indices; When It Runs Out It
+    Takes The Upper Half Of Another Worker's Remaining Share, So Uneven Tasks (Like
+    Games Of Wildly Different Lengths) Still Keep Every Core Busy. The Calling
+    Thread Works Alongside The Pool As Worker 0.
+
+*/
+class WorkPool
+{
+
+    public:
+
+        // Runs Task task On Worker worker (In [0, getThreadCount()))
+        using TaskBody = std::function<void(unsigned int task, unsigned int worker)>;
+
+
+    private:
+
+        // One Worker's Remaining Tasks [begin, end), Alone On Its Cache Line
+        struct alignas(CONFIG::CACHE_LINE_BYTES) TaskRange
+        {
+
+            std::mutex lock;
+            unsigned int begin = 0, end = 0;
+
+        };
+
+        unsigned int threadCount;
+        std::unique_ptr<TaskRange[]> ranges;
+        std::vector<std::thread> threads;
+
+        // Current Job, Handed To The Threads Under jobLock
+        std::mutex jobLock;
+        std::condition_variable jobReady, jobDone;
+        const TaskBody* job;
+        unsigned int jobGeneration;
+        unsigned int busyThreads;
+        bool stopping;
+
+
+        bool popTask(unsigned int worker, unsigned int& task);
+        bool stealTasks(unsigned int worker);
+        void runTasks(unsigned int worker);
+        void threadLoop(unsigned int worker);
+
+
+    public:
+
+        explicit WorkPool(unsigned int threads = std::thread::hardware_concurrency());
+        ~WorkPool();
+
+        WorkPool(const WorkPool&) = delete;
+        WorkPool& operator=(const WorkPool&) = delete;
+
+        void parallelFor(unsigned int count, const TaskBody& body);
+
+        // Getters
+        unsigned int getThreadCount() const { return threadCount; }
+
+};
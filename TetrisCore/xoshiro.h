@@ -0,0 +1,145 @@
+#pragma once
+
+
+#include <cstdint>
+
+
+
+/*
+
+    Desc: Small, Fast Pseudo-Random Generator (xoshiro256**) With Its Whole State
+    In Four Words. Every GameCore Owns One, So Seeding Two Games Alike Gives Them
+    The Same Piece Stream With No Shared Global State Like std::rand's.
+
+*/
+class Xoshiro256
+{
+
+    private:
+
+        std::uint64_t state[4];
+
+
+        static std::uint64_t rotl(std::uint64_t x, int k)
+        {
+
+            return (x << k) | (x >> (64 - k));
+
+        }
+
+
+    public:
+
+        /*
+
+            Desc: Creates A Generator Seeded With seedValue.
+
+            Preconditions:
+                1.) None
+
+            Postconditions:
+                1.) The Generator Is Seeded As If By seed(seedValue).
+
+        */
+        explicit Xoshiro256(std::uint64_t seedValue = 0)
+        {
+
+            seed(seedValue);
+
+        }
+
+
+        /*
+
+            Desc: Restarts The Generator From A 64-Bit Seed, Spreading It Over The Four
+            State Words With SplitMix64 So Even Small Or Similar Seeds Start Far Apart.
+
+            Preconditions:
+                1.) None
+
+            Postconditions:
+                1.) The Generator Will Produce The Stream Belonging To seedValue.
+
+        */
+        void seed(std::uint64_t seedValue)
+        {
+
+            for (std::uint64_t& word : state) {
+                seedValue += 0x9E3779B97F4A7C15ull;
+                std::uint64_t z = seedValue;
+                z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ull;
+                z = (z ^ (z >> 27)) * 0x94D049BB133111EBull;
+                word = z ^ (z >> 31);
+            }
+
+        }
+
+
+        /*
+
+            Desc: Advances The Generator, Returning 64 Random Bits.
+
+            Preconditions:
+                1.) None
+
+            Postconditions:
+                1.) Returns The Next Value Of The Stream.
+
+        */
+        std::uint64_t next()
+        {
+
+            const std::uint64_t result = rotl(state[1] * 5, 7) * 9;
+            const std::uint64_t t = state[1] << 17;
+
+            state[2] ^= state[0];
+            state[3] ^= state[1];
+            state[1] ^= state[2];
+            state[0] ^= state[3];
+            state[2] ^= t;
+            state[3] = rotl(state[3], 45);
+
+            return result;
+
+        }
+
+
+        /*
+
+            Desc: Returns A Uniform Value In [0, bound) By Scaling The Top 32 Bits,
+            Which Is Fast And Unbiased Enough For The Small Bounds We Draw From.
+
+            Preconditions:
+                1.) bound Is Greater Than 0.
+
+            Postconditions:
+                1.) Returns A Value In [0, bound).
+
+        */
+        std::uint32_t nextBelow(std::uint32_t bound)
+        {
+
+            return static_cast<std::uint32_t>(((next() >> 32) * bound) >> 32);
+
+        }
+
+
+        /*
+
+            Desc: Returns A Uniform Float In [0.0f, 1.0f).
+
+            Preconditions:
+                1.) None
+
+            Postconditions:
+                1.) Returns A Value In [0.0f, 1.0f).
+
+        */
+        float nextFloat()
+        {
+
+            return (next() >> 40) * (1.0f / 16777216.0f);
+
+        }
+
+};
@@ -0,0 +1,114 @@
+#pragma once
+
+
+#include <array>
+#include <cstdint>
+#include "bitboard.h"
+#include "pieces.h"
+
+
+
+/*
+
+    Desc: Random 64-Bit Keys For Zobrist Hashing: One Per Cell Of A Board Rows x Cols
+    And One Per Piece. A Board's Hash Is The XOR Of The Keys Of Its Occupied Cells,
+    So Filling Or Emptying A Cell Is A Single XOR, And Equal Boards Always Hash Alike.
+
+*/
+template <unsigned int Rows, unsigned int Cols>
+struct ZobristKeys
+{
+
+    std::array<std::uint64_t, Rows * Cols> cells;
+    std::array<std::uint64_t, PIECE_COUNT> pieces;
+
+};
+
+
+/*
+
+    Desc: Fills A ZobristKeys Table At Compile Time From A SplitMix64 Stream, The
+    Same Mixer Xoshiro256 Seeds Itself With.
+
+    Preconditions:
+        1.) None
+
+    Postconditions:
+        1.) Returns Keys Which Are Fixed For A Given Board Size.
+
+*/
+template <unsigned int Rows, unsigned int Cols>
+constexpr ZobristKeys<Rows, Cols> makeZobristKeys()
+{
+
+    ZobristKeys<Rows, Cols> keys{};
+    std::uint64_t state = 0x5A0B12157E7215ull ^ (std::uint64_t(Rows) << 32) ^ Cols;
+
+    auto next = [&state]() {
+        state += 0x9E3779B97F4A7C15ull;
+        std::uint64_t z = state;
+        z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ull;
+        z = (z ^ (z >> 27)) * 0x94D049BB133111EBull;
+        return z ^ (z >> 31);
+    };
+
+    for (std::uint64_t& key : keys.cells) key = next();
+    for (std::uint64_t& key : keys.pieces) key = next();
+    return keys;
+
+}
+
+
+// Keys For A Board Rows x Cols
+template <unsigned int Rows, unsigned int Cols>
+constexpr ZobristKeys<Rows, Cols> ZOBRIST_KEYS = makeZobristKeys<Rows, Cols>();
+
+
+/*
+
+    Desc: Hashes The Occupied Cells Of One Row.
+
+    Preconditions:
+        1.) row Is Within The Board; mask Holds No Bits Past Cols.
+
+    Postconditions:
+        1.) Returns The XOR Of The Keys Of Every Set Column Of mask In row.
+
+*/
+template <unsigned int Rows, unsigned int Cols>
+std::uint64_t hashRow(unsigned int row, std::uint32_t mask)
+{
+
+    const std::uint64_t* keys = &ZOBRIST_KEYS<Rows, Cols>.cells[row * Cols];
+
+    std::uint64_t hash = 0;
+    for (unsigned int col = 0; mask; ++col, mask >>= 1) {
+        if (mask & 1u) hash ^= keys[col];
+    }
+    return hash;
+
+}
+
+
+/*
+
+    Desc: Hashes A Whole Board From Scratch.
+
+    Preconditions:
+        1.) None
+
+    Postconditions:
+        1.) Returns The XOR Of The Keys Of Every Occupied Cell (0 For An Empty Board).
+
+*/
+template <unsigned int Rows, unsigned int Cols>
+std::uint64_t hashBoard(const BitBoard<Rows, Cols>& board)
+{
+
+    std::uint64_t hash = 0;
+    for (unsigned int row = 0; row < Rows; ++row) {
+        if (board.getRow(row)) hash ^= hashRow<Rows, Cols>(row, board.getRow(row));
+    }
+    return hash;
+
+}
@@ -0,0 +1,89 @@
+#include "finesse.h"
+#include "gamerecord.h"
+#include "workpool.h"
+#include "config.h"
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <filesystem>
+#include <iostream>
+#include <memory>
+#include <string>
+#include <vector>
+
+
+using Generator = MoveGenerator<CONFIG::BOARD_ROWS, CONFIG::BOARD_COLS>;
+
+
+/*
+
+	Usage: tetris_finesse [directory] [threads]
+
+	Replays Every Game Record In directory (Default CONFIG::RECORD_DIRECTORY, Where
+	The Game Saves Them) Across threads Threads (Default: Every Core), Comparing The
+	Shifts & Rotations Spent On Each Piece With The Fewest That Reach The Same
+	Placement, And Reports How Many Inputs Were Wasted.
+
+*/
+int main(int argc, char** argv)
+{
+
+	const std::string directory = argc > 1 ? argv[1] : CONFIG::RECORD_DIRECTORY;
+	unsigned int threads = argc > 2 ? std::strtoul(argv[2], nullptr, 10) : std::thread::hardware_concurrency();
+
+	std::vector<std::string> paths;
+	std::error_code error;
+	for (const auto& entry : std::filesystem::directory_iterator(directory, error)) {
+		if (entry.is_regular_file()) paths.push_back(entry.path().string());
+	}
+	if (error || paths.empty())
+	{
+		std::cerr << "No Game Records Found In " << directory << std::endl;
+		return 1;
+	}
+	std::sort(paths.begin(), paths.end());
+
+	WorkPool pool(threads);
+	auto generators = std::make_unique<Generator[]>(pool.getThreadCount());
+	std::vector<FinesseStats> results(paths.size());
+	std::vector<char> unreadable(paths.size(), 0);
+
+	auto start = std::chrono::steady_clock::now();
+
+	// Each Game Loads & Replays On Its Own Worker
+	pool.parallelFor(static_cast<unsigned int>(paths.size()), [&](unsigned int task, unsigned int worker) {
+		GameRecord record;
+		if (!loadGameRecord(paths[task], record))
+		{
+			unreadable[task] = 1;
+			return;
+		}
+		results[task] = analyzeFinesse(record, generators[worker]);
+	});
+
+	double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+	FinesseStats total;
+	unsigned int skipped = 0;
+	for (std::size_t i = 0; i < paths.size(); ++i) {
+		if (unreadable[i])
+		{
+			std::cerr << "Skipped Unreadable Record " << paths[i] << std::endl;
+			skipped++;
+			continue;
+		}
+		total += results[i];
+	}
+
+	std::cout << "Games:          " << paths.size() - skipped << " On " << pool.getThreadCount() << " Threads\n";
+	std::cout << "Pieces:         " << total.pieces << " (" << total.tucks << " Tucks & Spins)\n";
+	std::cout << "Keys:           " << total.keys << "\n";
+	std::cout << "Fewest Keys:    " << total.minimalKeys << "\n";
+	std::cout << "Wasted Keys:    " << total.wastedKeys << " (" << 100.0 * total.wastedRate() << "% Of Keys)\n";
+	std::cout << "Faulty Pieces:  " << total.faultyPieces << " (" << 100.0 * total.faultRate() << "% Of Pieces)\n";
+	std::cout << "Seconds:        " << seconds << "\n";
+	std::cout << "Games/sec:      " << (seconds > 0.0 ? (paths.size() - skipped) / seconds : 0.0) << std::endl;
+
+	return 0;
+
+}
@@ -0,0 +1,136 @@
+#include "alloctracker.h"
+#include <cstdlib>
+#include <new>
+
+#ifdef _WIN32
+#include <malloc.h>
+#endif
+
+
+namespace
+{
+
+    // Other Threads' Allocations Aren't The Caller's, So Each Thread Counts Its Own
+    thread_local std::size_t allocationCount = 0;
+
+
+    /*
+
+        Desc: Allocates size Bytes From The C Heap, Counting The Allocation.
+
+        Preconditions:
+            1.) None
+
+        Postconditions:
+            1.) Returns The Allocated Block, Or nullptr If The Heap Is Exhausted.
+            2.) The Calling Thread's Allocation Count Is Incremented.
+
+    */
+    void* countedAlloc(std::size_t size)
+    {
+
+        allocationCount++;
+        return std::malloc(size ? size : 1);
+
+    }
+
+
+    /*
+
+        Desc: Allocates size Bytes Aligned To alignment From The C Heap, Counting The
+        Allocation. Blocks From Here Must Be Released With alignedFree().
+
+        Preconditions:
+            1.) alignment Is A Power Of Two
+
+        Postconditions:
+            1.) Returns The Allocated Block, Or nullptr If The Heap Is Exhausted.
+            2.) The Calling Thread's Allocation Count Is Incremented.
+
+    */
+    void* countedAlignedAlloc(std::size_t size, std::align_val_t alignment)
+    {
+
+        allocationCount++;
+        std::size_t bytes = static_cast<std::size_t>(alignment);
+        if (bytes < sizeof(void*)) bytes = sizeof(void*);
+#ifdef _WIN32
+        return _aligned_malloc(size ? size : 1, bytes);
+#else
+        void* block = nullptr;
+        return posix_memalign(&block, bytes, size ? size : 1) == 0 ? block : nullptr;
+#endif
+
+    }
+
+
+    /*
+
+        Desc: Releases A Block From countedAlignedAlloc().
+
+        Preconditions:
+            1.) block Came From countedAlignedAlloc() Or Is nullptr
+
+        Postconditions:
+            1.) The Block Is Returned To The C Heap.
+
+    */
+    void alignedFree(void* block)
+    {
+
+#ifdef _WIN32
+        _aligned_free(block);
+#else
+        std::free(block);
+#endif
+
+    }
+
+}
+
+
+std::size_t ALLOC_TRACKER::getAllocationCount() { return allocationCount; }
+
+
+// Replacements Of The Global (Unaligned) Allocation Functions
+void* operator new(std::size_t size)
+{
+
+    void* block = countedAlloc(size);
+    if (!block) throw std::bad_alloc();
+    return block;
+
+}
+
+void* operator new[](std::size_t size) { return operator new(size); }
+void* operator new(std::size_t size, const std::nothrow_t&) noexcept { return countedAlloc(size); }
+void* operator new[](std::size_t size, const std::nothrow_t&) noexcept { return countedAlloc(size); }
+
+void operator delete(void* block) noexcept { std::free(block); }
+void operator delete[](void* block) noexcept { std::free(block); }
+void operator delete(void* block, std::size_t) noexcept { std::free(block); }
+void operator delete[](void* block, std::size_t) noexcept { std::free(block); }
+void operator delete(void* block, const std::nothrow_t&) noexcept { std::free(block); }
+void operator delete[](void* block, const std::nothrow_t&) noexcept { std::free(block); }
+
+
+// Replacements Of The Over-Aligned Forms (alignas Beyond The Default, e.g. WorkPool's Task Ranges)
+void* operator new(std::size_t size, std::align_val_t alignment)
+{
+
+    void* block = countedAlignedAlloc(size, alignment);
+    if (!block) throw std::bad_alloc();
+    return block;
+
+}
+
+void* operator new[](std::size_t size, std::align_val_t alignment) { return operator new(size, alignment); }
+void* operator new(std::size_t size, std::align_val_t alignment, const std::nothrow_t&) noexcept { return countedAlignedAlloc(size, alignment); }
+void* operator new[](std::size_t size, std::align_val_t alignment, const std::nothrow_t&) noexcept { return countedAlignedAlloc(size, alignment); }
+
+void operator delete(void* block, std::align_val_t) noexcept { alignedFree(block); }
+void operator delete[](void* block, std::align_val_t) noexcept { alignedFree(block); }
+void operator delete(void* block, std::size_t, std::align_val_t) noexcept { alignedFree(block); }
+void operator delete[](void* block, std::size_t, std::align_val_t) noexcept { alignedFree(block); }
+void operator delete(void* block, std::align_val_t, const std::nothrow_t&) noexcept { alignedFree(block); }
+void operator delete[](void* block, std::align_val_t, const std::nothrow_t&) noexcept { alignedFree(block); }
@@ -0,0 +1,24 @@
+#pragma once
+
+
+#include <cstddef>
+
+
+
+/*
+
+    Desc: Counts Every Heap Allocation Made Through The Global operator new, Over-Aligned
+    Forms Included, So tetris_frames Can Prove A Running Game Allocates Nothing Frame
+    To Frame. Counts Are Kept Per Thread: Search Workers And The Like Allocate On
+    Their Own Threads, And Only What The Calling Thread Did Is Wanted. Linking
+    alloctracker.cpp Replaces The Global Allocation Functions, So Only The Check
+    Itself Does.
+
+*/
+namespace ALLOC_TRACKER
+{
+
+    // Allocations The Calling Thread Has Made Through operator new So Far
+    std::size_t getAllocationCount();
+
+}
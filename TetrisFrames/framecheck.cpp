@@ -0,0 +1,332 @@
+#include "alloctracker.h"
+#include "bot.h"
+#include "gamecore.h"
+#include "gamerecord.h"
+#include "hintsearch.h"
+#include "xoshiro.h"
+#include "config.h"
+#include <array>
+#include <cstdint>
+#include <cstdlib>
+#include <iostream>
+#include <memory>
+#include <string>
+
+
+using Core = GameCore<CONFIG::BOARD_ROWS, CONFIG::BOARD_COLS>;
+
+constexpr unsigned int CHECKED_GAMES = 6;
+constexpr std::uint64_t CHECKED_SEED = 1;
+constexpr unsigned int MAX_PIECES = 150;          // Pieces Per Game Before It's Cut Short
+constexpr unsigned int KEY_ONE_IN = 3;            // How Often A Frame Has A Key Press In It
+constexpr unsigned int REPORTED_FRAMES = 5;
+
+
+/*
+
+	Desc: How A Game Is Played, Like The Window's B & H Keys: By Hand, By Hand With
+	Hints Showing, Or By The Bot.
+
+*/
+enum class PlayMode { KEYS, HINTS, BOT, COUNT };
+
+const char* const MODE_NAMES[] = { "Keys", "Hints", "Bot" };
+
+
+/*
+
+	Desc: Keeps Every Cell As Our Board Would For Drawing, From The Notifications Its
+	GameCore Sends, So Frames Do The Same Listener Work They Do On Screen.
+
+*/
+class MirroredGrid : public CoreListener
+{
+
+	private:
+
+		std::array<Cell, CONFIG::BOARD_ROWS * CONFIG::BOARD_COLS> cells;
+		unsigned int nextPiece;
+		Cell nextCell;
+		std::uint64_t linesCleared;
+
+
+	public:
+
+		MirroredGrid()
+			: nextPiece(0), nextCell(EMPTY_CELL), linesCleared(0)
+		{
+			cells.fill(EMPTY_CELL);
+		}
+
+		void onCellChanged(unsigned int row, unsigned int col, Cell cell) override
+		{
+			cells[row * CONFIG::BOARD_COLS + col] = cell;
+		}
+
+		void onRowMoved(unsigned int fromRow, unsigned int toRow) override
+		{
+			for (unsigned int c = 0; c < CONFIG::BOARD_COLS; ++c) {
+				cells[toRow * CONFIG::BOARD_COLS + c] = cells[fromRow * CONFIG::BOARD_COLS + c];
+			}
+		}
+
+		void onRowCleared(unsigned int row) override
+		{
+			for (unsigned int c = 0; c < CONFIG::BOARD_COLS; ++c) {
+				cells[row * CONFIG::BOARD_COLS + c] = EMPTY_CELL;
+			}
+		}
+
+		void onNextPieceChanged(unsigned int piece, Cell cell) override
+		{
+			nextPiece = piece;
+			nextCell = cell;
+		}
+
+		void onLinesCleared(unsigned int lines, unsigned int, bool) override
+		{
+			linesCleared += lines;
+		}
+
+};
+
+
+/*
+
+	Desc: Totals Of One Run.
+
+*/
+struct FrameTotals
+{
+
+	std::uint64_t frames[static_cast<unsigned int>(PlayMode::COUNT)];
+	std::uint64_t allocatingFrames[static_cast<unsigned int>(PlayMode::COUNT)];
+	std::uint64_t allocations;
+
+};
+
+
+/*
+
+	Desc: Plays Games Frame By Frame On The Calling Thread, Doing What The Window Does
+	Each Frame Of A Running Game Short Of Drawing: A Key Press Now And Then, The Hint
+	Kept In Step With The Search, And On Each Drop Tick The Bot's Inputs And A Gravity
+	Step, All Recorded Like A Played Game. Counts The Heap Allocations Each Frame Makes.
+
+*/
+class FrameCheck
+{
+
+	private:
+
+		Core core;
+		MirroredGrid grid;
+		GameRecord record;
+		Bot<CONFIG::BOARD_ROWS, CONFIG::BOARD_COLS> bot;
+		HintSearch<CONFIG::BOARD_ROWS, CONFIG::BOARD_COLS> hint;
+		Xoshiro256 rng;
+
+		// Hint Last Shown, Like Window's
+		unsigned int hintPiece;
+		bool hasShownHint;
+		Placement shownHint;
+
+		FrameTotals totals;
+
+
+		// One Key Press Of A Hand-Played Game, As Window::handleKeyInput Sends It
+		void pressKey(RecordingGame<Core>& game)
+		{
+
+			switch (rng.nextBelow(8))
+			{
+				case 0: case 1:
+					game.shiftActivePiece('L');
+					game.ghostPiece();
+					break;
+				case 2: case 3:
+					game.shiftActivePiece('R');
+					game.ghostPiece();
+					break;
+				case 4: case 5:
+					game.rotateActivePiece();
+					game.ghostPiece();
+					break;
+				case 6:
+					game.step();
+					break;
+				default:
+					game.shiftActivePiece('D');
+					break;
+			}
+
+		}
+
+
+		// Window::updateHint Without The Redraw Flag
+		void updateHint()
+		{
+
+			if (!core.isPieceActive() || core.isGameOver())
+			{
+				hint.cancel();
+				core.clearHint();
+				hintPiece = UINT32_MAX;
+				hasShownHint = false;
+				return;
+			}
+
+			if (core.getPiecesLocked() != hintPiece)
+			{
+				hint.start(core.getOccupancy(), core.getActivePiece(), core.getNextPiece(), core.getActiveRotation(), core.getActiveRow(), core.getActiveCol());
+				hintPiece = core.getPiecesLocked();
+				hasShownHint = false;
+			}
+
+			Placement latest;
+			unsigned int stage;
+			if (!hint.getHint(latest, stage)) return;
+
+			if (!hasShownHint || latest.rotation != shownHint.rotation || latest.row != shownHint.row || latest.col != shownHint.col)
+			{
+				core.setHint(latest.rotation, latest.row, latest.col);
+				shownHint = latest;
+				hasShownHint = true;
+			}
+
+		}
+
+
+		/*
+
+			Desc: Plays One Frame Of A Running Game.
+
+			Preconditions:
+				1.) The Game Isn't Over.
+
+			Postconditions:
+				1.) The Game Has Moved On By One Frame, Possibly Ending.
+
+		*/
+		void playFrame(PlayMode mode, unsigned int frame)
+		{
+
+			RecordingGame<Core> game(core, record);
+			if (mode != PlayMode::BOT && rng.nextBelow(KEY_ONE_IN) == 0 && core.isPieceActive()) pressKey(game);
+
+			// Drop Speed Follows The Level, As In Window::getDropSpeed
+			const float normLevel = std::min(core.getLevel() / static_cast<float>(CONFIG::MAX_LEVEL), 1.0f);
+			const unsigned int dropSpeed = static_cast<unsigned int>(CONFIG::BASE_DROP_SPEED - normLevel * normLevel * CONFIG::SPEED_CURVE_FACTOR);
+			if (frame % dropSpeed == 0 && !core.isGameOver())
+			{
+				if (mode == PlayMode::BOT) bot.playPiece(game, core);
+				record.inputs.push_back(RECORD_INPUT::GRAVITY);
+				core.step();
+			}
+
+			if (mode == PlayMode::HINTS) updateHint();
+
+		}
+
+
+	public:
+
+		FrameCheck(std::uint64_t seed)
+			: core(seed), bot(CONFIG::BOT_BEAM_WIDTH), rng(seed), hintPiece(UINT32_MAX), hasShownHint(false), shownHint{}, totals{}
+		{
+
+			core.setListener(&grid);
+			record.inputs.reserve(CONFIG::RECORD_RESERVED_INPUTS);
+
+		}
+
+
+		/*
+
+			Desc: Plays One Game In mode From A Fresh Board, Counting Allocations In
+			Every Frame That Starts & Ends Mid-Game (Starting Or Ending A Game May
+			Allocate; Playing One Must Not).
+
+		*/
+		void playGame(unsigned int game, PlayMode mode)
+		{
+
+			core.reset(rng.next());
+			record.seed = core.getSeed();
+			record.inputs.clear();
+			core.step();
+
+			const unsigned int m = static_cast<unsigned int>(mode);
+			for (unsigned int frame = 1; !core.isGameOver() && core.getPiecesLocked() < MAX_PIECES; ++frame) {
+				const std::size_t before = ALLOC_TRACKER::getAllocationCount();
+				playFrame(mode, frame);
+				if (core.isGameOver()) break;
+
+				const std::size_t allocations = ALLOC_TRACKER::getAllocationCount() - before;
+				totals.frames[m]++;
+				if (allocations)
+				{
+					totals.allocations += allocations;
+					if (totals.allocatingFrames[m]++ < REPORTED_FRAMES)
+					{
+						std::cout << "Game " << game << " (" << MODE_NAMES[m] << ") Frame " << frame << ": " << allocations << " Heap Allocations\n";
+					}
+				}
+			}
+
+			hint.cancel();
+			core.clearHint();
+			hintPiece = UINT32_MAX;
+
+		}
+
+
+		const FrameTotals& getTotals() const { return totals; }
+
+};
+
+
+/*
+
+	Usage: tetris_frames [games] [seed]
+
+	Plays games Games (Default 6) From seed (Default 1) Frame By Frame, Taking Turns
+	Playing By Hand, By Hand With Hints, And By Bot, Each Up To 150 Pieces, And Fails
+	If Any Frame Of A Running Game Makes A Heap Allocation On The Game's Thread. The
+	Search Threads Behind The Bot & Hints Are Left Out, As Is Drawing.
+
+*/
+int main(int argc, char** argv)
+{
+
+	unsigned int games = argc > 1 ? std::strtoul(argv[1], nullptr, 10) : CHECKED_GAMES;
+	std::uint64_t seed = argc > 2 ? std::strtoull(argv[2], nullptr, 10) : CHECKED_SEED;
+
+	// Make Sure The Counting operator new Is The One Linked, Or Every Frame Would Pass
+	const std::size_t before = ALLOC_TRACKER::getAllocationCount();
+	int* volatile probe = new int(0);
+	delete probe;
+	if (ALLOC_TRACKER::getAllocationCount() == before)
+	{
+		std::cerr << "Allocations Aren't Being Counted" << std::endl;
+		return 1;
+	}
+
+	auto check = std::make_unique<FrameCheck>(seed);
+	for (unsigned int game = 0; game < games; ++game) {
+		check->playGame(game, static_cast<PlayMode>(game % static_cast<unsigned int>(PlayMode::COUNT)));
+	}
+
+	const FrameTotals& totals = check->getTotals();
+	std::uint64_t allocatingFrames = 0;
+	std::cout << "Games:          " << games << " (Seed " << seed << ")\n";
+	for (unsigned int m = 0; m < static_cast<unsigned int>(PlayMode::COUNT); ++m) {
+		std::cout << MODE_NAMES[m] << ":" << std::string(15 - std::char_traits<char>::length(MODE_NAMES[m]), ' ')
+			<< totals.frames[m] << " Frames, " << totals.allocatingFrames[m] << " Allocating\n";
+		allocatingFrames += totals.allocatingFrames[m];
+	}
+	std::cout << "Allocations:    " << totals.allocations << std::endl;
+
+	return allocatingFrames ? 1 : 0;
+
+}
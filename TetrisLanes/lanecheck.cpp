@@ -0,0 +1,414 @@
+#include "batchsim.h"
+#include "boardbatch.h"
+#include "evaluator.h"
+#include "gamecore.h"
+#include "movegen.h"
+#include "xoshiro.h"
+#include "config.h"
+#include <array>
+#include <atomic>
+#include <cstdlib>
+#include <iostream>
+#include <memory>
+#include <string>
+#include <type_traits>
+
+
+constexpr unsigned int LANES = 16;
+constexpr unsigned int CHECKED_GAMES = 64;
+constexpr std::uint64_t CHECKED_SEED = 1;
+constexpr unsigned int MAX_PIECES = 400;       // Pieces Per Game Before It's Cut Short
+constexpr unsigned int EXPLORE_ONE_IN = 8;     // How Often A Piece Goes Somewhere At Random Instead
+constexpr unsigned int REPORTED_MISMATCHES = 5;
+constexpr unsigned int POLICY_BOARDS = 64;     // BatchSimulator Boards For The Policy Call Check
+
+
+/*
+
+	Desc: Name Of A SIMD Flavour, For Reporting.
+
+*/
+template <typename Ops>
+const char* flavourName()
+{
+
+#ifdef TETRIS_SIMD_AVX2
+	if (std::is_same<Ops, SIMD::AVX2>::value) return "AVX2";
+#endif
+#ifdef TETRIS_SIMD_SSE2
+	if (std::is_same<Ops, SIMD::SSE2>::value) return "SSE2";
+#endif
+	return "Scalar";
+
+}
+
+
+/*
+
+	Desc: Totals Of One Board Size's Run.
+
+*/
+struct CheckTotals
+{
+
+	std::uint64_t games, pieces, lines, steps;
+	std::uint64_t scalarMismatches, wideMismatches;
+
+};
+
+
+/*
+
+	Desc: Plays Seeded Games On GameCores LANES At A Time, Mirroring Every Spawn Into
+	Two BoardBatches (One Pinned To SIMD::Scalar, One On The Widest Flavour The Target
+	Has) And Stepping All Three Together. After Every Step Each Batch's Locked Rows,
+	Active Piece, Score, Lines, And Level Must Match Its GameCore's, And A Batch Must
+	Refuse A Spawn Exactly When Its GameCore Tops Out. Pieces Are Placed Greedily By
+	evaluateBoard (With Some At Random) So Games Run Long And Clear Plenty Of Lines.
+
+*/
+template <unsigned int Rows, unsigned int Cols>
+class LaneCheck
+{
+
+	public:
+
+		using Core = GameCore<Rows, Cols>;
+		using Bits = typename Core::Bits;
+		using ScalarBatch = BoardBatch<Rows, Cols, LANES, SIMD::Scalar>;
+		using WideBatch = BoardBatch<Rows, Cols, LANES>;
+
+
+	private:
+
+		std::array<Core, LANES> cores;
+		std::array<Xoshiro256, LANES> rngs;
+		ScalarBatch scalar;
+		WideBatch wide;
+		CheckTotals totals;
+
+
+		/*
+
+			Desc: Picks Where The Active Piece Goes: The Rotation & Column Whose Straight
+			Drop From The Top Row Scores Best, Or Now And Then Any That Fits.
+
+		*/
+		static Placement choosePlacement(const Core& core, Xoshiro256& rng)
+		{
+
+			const Bits& board = core.getOccupancy();
+			const unsigned int piece = core.getActivePiece();
+			const bool explore = rng.nextBelow(EXPLORE_ONE_IN) == 0;
+
+			Placement best{ 0, 0, static_cast<std::uint8_t>(core.getActiveCol()) };
+			float bestScore = 0.0f;
+			unsigned int candidates = 0;
+
+			for (unsigned int rotation = 0; rotation < ROTATION_COUNT; ++rotation) {
+				const PieceRotation& shape = PIECE_TABLE_FOR<Cols>.get(piece, rotation);
+				for (unsigned int col = 0; col + shape.width <= Cols; ++col) {
+					if (board.collides(shape.rows, shape.height, 0, col)) continue;
+
+					unsigned int row = 0;
+					while (!board.collides(shape.rows, shape.height, row + 1, col)) row++;
+
+					const Placement placement{ static_cast<std::uint8_t>(rotation), static_cast<std::uint8_t>(row), static_cast<std::uint8_t>(col) };
+					candidates++;
+					if (explore)
+					{
+						if (rng.nextBelow(candidates) == 0) best = placement;
+						continue;
+					}
+
+					Bits child = board;
+					const unsigned int lines = applyPlacement(child, piece, placement);
+					const float score = evaluateBoard(child, lines);
+					if (candidates == 1 || score > bestScore)
+					{
+						best = placement;
+						bestScore = score;
+					}
+				}
+			}
+
+			return best;
+
+		}
+
+
+		/*
+
+			Desc: Turns & Slides The Active Piece Toward placement Along The Top Row,
+			Stopping Wherever The Board Blocks It.
+
+		*/
+		static void movePiece(Core& core, const Placement& placement)
+		{
+
+			for (unsigned int turns = placement.rotation; turns > 0; --turns) {
+				core.rotateActivePiece();
+			}
+
+			while (core.getActiveCol() != placement.col) {
+				const unsigned int before = core.getActiveCol();
+				core.shiftActivePiece(before > placement.col ? 'L' : 'R');
+				if (core.getActiveCol() == before) break;
+			}
+
+		}
+
+
+		/*
+
+			Desc: Compares One Board Of A Batch Against Its GameCore, Reporting The
+			First Few Differences.
+
+		*/
+		template <typename Batch>
+		static bool matches(const Batch& batch, unsigned int lane, const Core& core, std::uint64_t& mismatches)
+		{
+
+			bool same = batch.getScore(lane) == core.getScore() && batch.getLinesCleared(lane) == core.getLinesCleared() &&
+				batch.getLevel(lane) == core.getLevel();
+
+			const PieceRotation& shape = PIECE_TABLE_FOR<Cols>.get(core.getActivePiece(), core.getActiveRotation());
+			for (unsigned int r = 0; r < Rows && same; ++r) {
+				std::uint16_t piece = 0;
+				if (core.isPieceActive() && r >= core.getActiveRow() && r < core.getActiveRow() + shape.height)
+				{
+					piece = static_cast<std::uint16_t>(shape.rows[r - core.getActiveRow()] << core.getActiveCol());
+				}
+				same = batch.getRow(lane, r) == core.getOccupancy().getRow(r) && batch.getPieceRow(lane, r) == piece;
+			}
+
+			if (!same && mismatches++ < REPORTED_MISMATCHES)
+			{
+				std::cout << "  " << flavourName<typename Batch::Ops>() << " Lane " << lane << " (Seed " << core.getSeed() << ") Differs After "
+					<< core.getPiecesLocked() << " Pieces\n";
+			}
+			return same;
+
+		}
+
+
+		/*
+
+			Desc: Plays One Batch Of LANES Games To The End, Seeding Each From seeder.
+
+		*/
+		void playBatch(Xoshiro256& seeder)
+		{
+
+			typename ScalarBatch::LaneMask live = ScalarBatch::ALL_LANES;
+			for (unsigned int lane = 0; lane < LANES; ++lane) {
+				cores[lane].reset(seeder.next());
+				rngs[lane] = Xoshiro256(seeder.next());
+				scalar.resetLane(lane);
+				wide.resetLane(lane);
+			}
+
+			while (live) {
+				// Spawn & Place A Piece On Every Board Waiting For One, In All Three
+				for (unsigned int lane = 0; lane < LANES; ++lane) {
+					if (!((live >> lane) & 1u)) continue;
+
+					Core& core = cores[lane];
+					if (core.isPieceActive()) continue;
+
+					if (core.getPiecesLocked() >= MAX_PIECES)
+					{
+						live &= ~(1u << lane);
+						continue;
+					}
+
+					const PieceRotation& spawnShape = PIECE_TABLE_FOR<Cols>.get(core.getNextPiece(), 0);
+					core.step();
+					if (core.isGameOver())
+					{
+						// Topping Out Leaves The Batches As They Were, So Their Boards Can Still Be Compared
+						if (scalar.spawn(lane, spawnShape, spawnShape.spawnCol)) totals.scalarMismatches++;
+						if (wide.spawn(lane, spawnShape, spawnShape.spawnCol)) totals.wideMismatches++;
+						live &= ~(1u << lane);
+						continue;
+					}
+
+					movePiece(core, choosePlacement(core, rngs[lane]));
+					const PieceRotation& shape = PIECE_TABLE_FOR<Cols>.get(core.getActivePiece(), core.getActiveRotation());
+					if (!scalar.spawn(lane, shape, core.getActiveCol())) totals.scalarMismatches++;
+					if (!wide.spawn(lane, shape, core.getActiveCol())) totals.wideMismatches++;
+				}
+
+				// Step Everything Once
+				for (unsigned int lane = 0; lane < LANES; ++lane) {
+					if ((live >> lane) & 1u) cores[lane].step();
+				}
+				scalar.step();
+				wide.step();
+				totals.steps++;
+
+				for (unsigned int lane = 0; lane < LANES; ++lane) {
+					if (!((live >> lane) & 1u)) continue;
+
+					const bool scalarSame = matches(scalar, lane, cores[lane], totals.scalarMismatches);
+					const bool wideSame = matches(wide, lane, cores[lane], totals.wideMismatches);
+					if (!scalarSame || !wideSame) live &= ~(1u << lane);
+				}
+			}
+
+			for (const Core& core : cores) {
+				totals.games++;
+				totals.pieces += core.getPiecesLocked();
+				totals.lines += core.getLinesCleared();
+			}
+
+		}
+
+
+	public:
+
+		LaneCheck()
+			: totals{}
+		{
+		}
+
+
+		CheckTotals run(unsigned int games, std::uint64_t seed)
+		{
+
+			totals = {};
+			Xoshiro256 seeder(seed);
+			for (unsigned int played = 0; played < games; played += LANES) {
+				playBatch(seeder);
+			}
+			return totals;
+
+		}
+
+};
+
+
+/*
+
+	Desc: Random Drop Policy That Also Counts Its Calls Each Game, And At Each Game's
+	End Counts The Game As Bad If It Was Called Other Than Once Per Locked Piece Or
+	Was Ever Handed A Core With No Live Piece To Place.
+
+*/
+struct CountingPolicy
+{
+
+	std::atomic<std::uint64_t>* badGames;
+	unsigned int calls;
+	bool handedDeadCore;
+
+	explicit CountingPolicy(std::atomic<std::uint64_t>* badGames)
+		: badGames(badGames), calls(0), handedDeadCore(false)
+	{
+	}
+
+	template <typename Core>
+	void operator()(Core& core, Xoshiro256& rng)
+	{
+		calls++;
+		if (!core.isPieceActive() || core.isGameOver()) handedDeadCore = true;
+		RandomDropPolicy()(core, rng);
+	}
+
+	template <typename Core>
+	void gameOver(const Core& core)
+	{
+		if (calls != core.getPiecesLocked() || handedDeadCore) badGames->fetch_add(1, std::memory_order_relaxed);
+		calls = 0;
+		handedDeadCore = false;
+	}
+
+};
+
+
+/*
+
+	Desc: Plays games Games Per Board On A BatchSimulator Under CountingPolicy And
+	Prints How Many Called Their Policy Other Than Once Per Locked Piece, Returning
+	Whether None Did.
+
+*/
+bool checkPolicyCalls(unsigned int games, std::uint64_t seed)
+{
+
+	std::cout << "BatchSimulator Policy Calls (Seed " << seed << ")\n";
+
+	std::atomic<std::uint64_t> badGames{ 0 };
+	BatchSimulator<CONFIG::BOARD_ROWS, CONFIG::BOARD_COLS> simulator(POLICY_BOARDS, seed);
+	const BatchStats stats = simulator.run(games, CountingPolicy(&badGames));
+
+	std::cout << "  Games:      " << stats.games << "\n";
+	std::cout << "  Pieces:     " << stats.pieces << "\n";
+	if (badGames) std::cout << "  Calls:      " << badGames << " GAMES OFF\n";
+	else std::cout << "  Calls:      ok\n";
+	std::cout << std::flush;
+
+	return !badGames;
+
+}
+
+
+/*
+
+	Desc: Runs The Check On One Board Size And Prints Its Totals, Returning
+	Whether Both Batches Matched GameCore Throughout.
+
+*/
+template <unsigned int Rows, unsigned int Cols>
+bool checkBoardSize(unsigned int games, std::uint64_t seed)
+{
+
+	std::cout << Rows << "x" << Cols << " (Seed " << seed << ")\n";
+
+	auto check = std::make_unique<LaneCheck<Rows, Cols>>();
+	const CheckTotals totals = check->run(games, seed);
+
+	std::cout << "  Games:      " << totals.games << "\n";
+	std::cout << "  Pieces:     " << totals.pieces << "\n";
+	std::cout << "  Lines:      " << totals.lines << "\n";
+	std::cout << "  Steps:      " << totals.steps << " x " << LANES << " Lanes\n";
+
+	const char* names[] = { "Scalar", flavourName<typename LaneCheck<Rows, Cols>::WideBatch::Ops>() };
+	const std::uint64_t mismatches[] = { totals.scalarMismatches, totals.wideMismatches };
+	for (unsigned int i = 0; i < 2; ++i) {
+		std::cout << "  " << names[i] << ":" << std::string(11 - std::char_traits<char>::length(names[i]), ' ');
+		if (mismatches[i]) std::cout << mismatches[i] << " MISMATCHES\n";
+		else std::cout << "ok\n";
+	}
+	std::cout << std::flush;
+
+	return !totals.scalarMismatches && !totals.wideMismatches;
+
+}
+
+
+/*
+
+	Usage: tetris_lanes [games] [seed]
+
+	Plays games Seeded Games (Default 64, Rounded Up To Whole Batches Of 16) From
+	seed (Default 1) On Both Batched Board Sizes Through GameCore, A Scalar
+	BoardBatch, And A BoardBatch On The Widest SIMD Flavour This Build Has, Failing
+	If Any Board's Locked Rows, Active Piece, Score, Lines, Or Level Ever Differ.
+	Then Plays games Games On Each Of A BatchSimulator's Boards, Failing If Any
+	Game Calls Its Policy Other Than Once Per Locked Piece.
+
+*/
+int main(int argc, char** argv)
+{
+
+	unsigned int games = argc > 1 ? std::strtoul(argv[1], nullptr, 10) : CHECKED_GAMES;
+	std::uint64_t seed = argc > 2 ? std::strtoull(argv[2], nullptr, 10) : CHECKED_SEED;
+
+	bool passed = checkBoardSize<CONFIG::BOARD_ROWS, CONFIG::BOARD_COLS>(games, seed);
+	passed = checkBoardSize<CONFIG::TALL_BOARD_ROWS, CONFIG::BOARD_COLS>(games, seed) && passed;
+	passed = checkPolicyCalls(games, seed) && passed;
+
+	return passed ? 0 : 1;
+
+}
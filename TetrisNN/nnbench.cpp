@@ -0,0 +1,214 @@
+#include "nneval.h"
+#include "movegen.h"
+#include "piecestream.h"
+#include "xoshiro.h"
+#include "config.h"
+#include <chrono>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <memory>
+#include <string>
+#include <vector>
+
+
+using Evaluator = NetworkEvaluator<CONFIG::BOARD_ROWS, CONFIG::BOARD_COLS>;
+using Generator = Evaluator::Generator;
+using Bits = Evaluator::Bits;
+
+
+/*
+
+	Desc: Writes A Weights File Of Small Random Weights, For Trying The Evaluator
+	Before A Trained Network Exists.
+
+	Preconditions:
+		1.) hidden1 & hidden2 Are Multiples Of 32 Up To CONFIG::NN_MAX_HIDDEN.
+
+	Postconditions:
+		1.) Returns False If path Couldn't Be Written.
+
+*/
+bool writeRandomNetwork(const std::string& path, unsigned int hidden1, unsigned int hidden2, std::uint64_t seed)
+{
+
+	NetworkHeader header{};
+	header.magic = NetworkHeader::MAGIC;
+	header.version = NetworkHeader::VERSION;
+	header.rows = CONFIG::BOARD_ROWS;
+	header.cols = CONFIG::BOARD_COLS;
+	header.hidden1 = hidden1;
+	header.hidden2 = hidden2;
+	header.shift1 = 2;
+	header.shift2 = 6;
+	header.outputScale = 1.0f / 256.0f;
+
+	const NetworkLayout layout = networkLayout(header);
+	std::vector<unsigned char> bytes(layout.bytes, 0);
+	std::memcpy(bytes.data(), &header, sizeof(header));
+
+	Xoshiro256 rng(seed);
+	auto fill = [&](std::size_t offset, std::size_t count, int span) {
+		for (std::size_t i = 0; i < count; ++i) {
+			bytes[offset + i] = static_cast<unsigned char>(static_cast<std::int8_t>(static_cast<int>(rng.nextBelow(2 * span + 1)) - span));
+		}
+	};
+
+	// Input Columns Small Enough That A Full Board Can't Saturate The 16-Bit Sums
+	fill(layout.inputWeights, std::size_t(Evaluator::INPUTS) * hidden1, 32);
+	fill(layout.hiddenWeights, std::size_t(hidden2) * hidden1, 64);
+	fill(layout.outputWeights, hidden2, 127);
+
+	std::ofstream file(path, std::ios::binary);
+	file.write(reinterpret_cast<const char*>(bytes.data()), static_cast<std::streamsize>(bytes.size()));
+	return static_cast<bool>(file);
+
+}
+
+
+/*
+
+	Desc: Scores Every Placement generator Holds With kernel's Batch Call And
+	Counts How Many Differ From expected.
+
+*/
+template <typename Kernel>
+std::uint64_t countMismatches(const Evaluator& evaluator, const Bits& board, unsigned int piece, const Generator& generator, const float* expected)
+{
+
+	float scores[Generator::STATE_COUNT];
+	const unsigned int count = evaluator.evaluatePlacements<Kernel>(board, piece, generator, scores);
+
+	std::uint64_t mismatches = 0;
+	for (unsigned int i = 0; i < count; ++i) {
+		if (scores[i] != expected[i]) mismatches++;
+	}
+	return mismatches;
+
+}
+
+
+// Every Kernel Flavour This Target Has, Checked Separately
+const char* const FLAVOURS[] = {
+	"Scalar",
+#ifdef TETRIS_SIMD_SSE2
+	"SSE2",
+#endif
+#ifdef TETRIS_SIMD_AVX2
+	"AVX2",
+#endif
+};
+
+constexpr unsigned int FLAVOUR_COUNT = sizeof(FLAVOURS) / sizeof(FLAVOURS[0]);
+
+
+/*
+
+	Usage: tetris_nn [weights] [placements] [seed]
+	       tetris_nn --random <weights> [hidden1] [hidden2] [seed]
+
+	Maps A Network Weights File (Default CONFIG::NN_WEIGHTS_FILE) And Plays Random
+	Placements On One Core Until placements Pieces Are Placed, Scoring Every
+	Reachable Placement Of Each Piece With NetworkEvaluator's Batch Call, Then
+	Reports Evaluations Per Second. Every Board Is Also Scored One At A Time With
+	The Scalar Kernel, And Each Kernel Flavour The Build Has (Scalar, SSE2, AVX2)
+	Runs The Batch Call Untimed, Failing If Any Score Differs. --random Writes A
+	Network Of Random Weights To Try It With.
+
+*/
+int main(int argc, char** argv)
+{
+
+	if (argc > 2 && !std::strcmp(argv[1], "--random"))
+	{
+		unsigned int hidden1 = argc > 3 ? std::strtoul(argv[3], nullptr, 10) : 128;
+		unsigned int hidden2 = argc > 4 ? std::strtoul(argv[4], nullptr, 10) : 32;
+		std::uint64_t seed = argc > 5 ? std::strtoull(argv[5], nullptr, 10) : 1;
+		if (!hidden1 || !hidden2 || hidden1 % 32 || hidden2 % 32 || hidden1 > CONFIG::NN_MAX_HIDDEN || hidden2 > CONFIG::NN_MAX_HIDDEN)
+		{
+			std::cerr << "Hidden Layers Must Be Multiples Of 32 Up To " << CONFIG::NN_MAX_HIDDEN << std::endl;
+			return 1;
+		}
+		if (!writeRandomNetwork(argv[2], hidden1, hidden2, seed))
+		{
+			std::cerr << "Failed To Write " << argv[2] << std::endl;
+			return 1;
+		}
+		std::cout << "Wrote " << hidden1 << "x" << hidden2 << " Random Network To " << argv[2] << std::endl;
+		return 0;
+	}
+
+	const std::string path = argc > 1 ? argv[1] : CONFIG::NN_WEIGHTS_FILE;
+	unsigned int pieces = argc > 2 ? std::strtoul(argv[2], nullptr, 10) : 20000;
+	std::uint64_t seed = argc > 3 ? std::strtoull(argv[3], nullptr, 10) : 1;
+
+	auto evaluator = std::make_unique<Evaluator>();
+	if (!evaluator->load(path))
+	{
+		std::cerr << "Couldn't Load Network Weights From " << path << std::endl;
+		return 1;
+	}
+
+	auto generator = std::make_unique<Generator>();
+	PieceStream stream(seed);
+	Xoshiro256 rng(seed);
+	Bits board{};
+	float scores[Generator::STATE_COUNT], expected[Generator::STATE_COUNT];
+
+	std::uint64_t evaluations = 0, mismatches[FLAVOUR_COUNT] = {};
+	double seconds = 0.0;
+	unsigned int games = 1;
+
+	for (unsigned int placed = 0; placed < pieces; ++placed) {
+		const unsigned int piece = stream.deal();
+		const unsigned int count = generator->generate(board, piece);
+		if (!count)
+		{
+			board = Bits{};
+			games++;
+			continue;
+		}
+
+		// Only The Batch Call Is Timed
+		auto start = std::chrono::steady_clock::now();
+		evaluator->evaluatePlacements(board, piece, *generator, scores);
+		seconds += std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+		evaluations += count;
+
+		for (unsigned int i = 0; i < count; ++i) {
+			Bits after = board;
+			const unsigned int lines = applyPlacement(after, piece, generator->getPlacement(i));
+			expected[i] = evaluator->evaluate<NN_KERNEL::Scalar>(after, lines);
+
+			// The Timed Call Ran Best, The Last Flavour Listed
+			if (scores[i] != expected[i]) mismatches[FLAVOUR_COUNT - 1]++;
+		}
+
+		unsigned int flavour = 0;
+		mismatches[flavour++] += countMismatches<NN_KERNEL::Scalar>(*evaluator, board, piece, *generator, expected);
+#ifdef TETRIS_SIMD_SSE2
+		mismatches[flavour++] += countMismatches<NN_KERNEL::SSE2>(*evaluator, board, piece, *generator, expected);
+#endif
+#ifdef TETRIS_SIMD_AVX2
+		mismatches[flavour++] += countMismatches<NN_KERNEL::AVX2>(*evaluator, board, piece, *generator, expected);
+#endif
+
+		applyPlacement(board, piece, generator->getPlacement(rng.nextBelow(count)));
+	}
+
+	const NetworkHeader& header = evaluator->getHeader();
+	std::cout << "Network:           " << Evaluator::INPUTS << "x" << header.hidden1 << "x" << header.hidden2 << "x1 (int8)\n";
+	std::cout << "Pieces:            " << pieces << " Over " << games << " Games\n";
+	std::cout << "Evaluations:       " << evaluations << "\n";
+	std::uint64_t totalMismatches = 0;
+	for (unsigned int flavour = 0; flavour < FLAVOUR_COUNT; ++flavour) {
+		std::cout << FLAVOURS[flavour] << " Mismatches:" << std::string(7 - std::char_traits<char>::length(FLAVOURS[flavour]), ' ') << mismatches[flavour] << "\n";
+		totalMismatches += mismatches[flavour];
+	}
+	std::cout << "Seconds:           " << seconds << "\n";
+	std::cout << "Evaluations/sec:   " << (seconds > 0.0 ? evaluations / seconds : 0.0) << " (One Core)" << std::endl;
+
+	return totalMismatches ? 1 : 0;
+
+}
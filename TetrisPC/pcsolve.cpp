@@ -0,0 +1,129 @@
+#include "pcsolver.h"
+#include "config.h"
+#include <chrono>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <memory>
+
+
+using Bits = BitBoard<CONFIG::BOARD_ROWS, CONFIG::BOARD_COLS>;
+using Solver = PerfectClearSolver<CONFIG::BOARD_ROWS, CONFIG::BOARD_COLS>;
+
+// Letter Of Each Piece, Indexed Like PIECE_TABLE
+constexpr char PIECE_LETTERS[PIECE_COUNT + 1] = "IOTSZLJ";
+
+constexpr unsigned int LISTED_SOLUTIONS = 20;
+
+
+/*
+
+	Desc: Reads A Piece Queue Like "IOTSZLJ" Into Piece Indices.
+
+*/
+bool loadQueue(const char* text, unsigned int* queue, unsigned int& length)
+{
+
+	length = 0;
+	for (; *text; ++text) {
+		const char* letter = std::strchr(PIECE_LETTERS, *text);
+		if (!letter || length == Solver::MAX_PIECES) return false;
+		queue[length++] = static_cast<unsigned int>(letter - PIECE_LETTERS);
+	}
+	return length > 0;
+
+}
+
+
+/*
+
+	Desc: Builds A Bit Board From Rows Like "##....####/###..#####", Top Row First
+	('#' Filled, '.' Empty), Ending On The Floor.
+
+*/
+bool loadBoard(const char* text, Bits& board)
+{
+
+	unsigned int height = text[0] ? 1 : 0;
+	for (const char* c = text; *c; ++c) {
+		if (*c == '/') height++;
+	}
+	if (height > CONFIG::BOARD_ROWS) return false;
+
+	unsigned int row = CONFIG::BOARD_ROWS - height, col = 0;
+	for (const char* c = text; *c; ++c) {
+		if (*c == '/')
+		{
+			row++;
+			col = 0;
+			continue;
+		}
+		if (col == CONFIG::BOARD_COLS || (*c != '#' && *c != '.')) return false;
+
+		if (*c == '#')
+		{
+			const std::uint16_t cell = static_cast<std::uint16_t>(1u << col);
+			board.place(&cell, 1, row, 0);
+		}
+		col++;
+	}
+	return true;
+
+}
+
+
+/*
+
+	Usage: tetris_pc queue [board] [threads] [maxHeight]
+
+	Finds Every Way Of Placing queue (Piece Letters, In Order, No Hold) That Empties
+	board (Rows Top First, Split By '/'; Default Empty) Without Stacking Past
+	maxHeight Rows (Default CONFIG::PC_MAX_HEIGHT), Searching Across threads Threads
+	(Default: Every Core). Prints How Many There Are, The First Few As Each Piece's
+	Rotation, Column, And Row, And Fields Searched Per Second.
+
+*/
+int main(int argc, char** argv)
+{
+
+	unsigned int queue[Solver::MAX_PIECES], length = 0;
+	Bits board;
+
+	if (argc < 2 || !loadQueue(argv[1], queue, length))
+	{
+		std::cerr << "Usage: tetris_pc queue [board] [threads] [maxHeight]  (queue Like IOTSZLJ, At Most " << Solver::MAX_PIECES << " Pieces)" << std::endl;
+		return 1;
+	}
+	if (argc > 2 && !loadBoard(argv[2], board))
+	{
+		std::cerr << "Board Rows Must Be '#' & '.', At Most " << CONFIG::BOARD_COLS << " Wide, Split By '/'" << std::endl;
+		return 1;
+	}
+
+	unsigned int threads = argc > 3 ? std::strtoul(argv[3], nullptr, 10) : std::thread::hardware_concurrency();
+	unsigned int maxHeight = argc > 4 ? std::strtoul(argv[4], nullptr, 10) : CONFIG::PC_MAX_HEIGHT;
+
+	auto solver = std::make_unique<Solver>(threads);
+
+	auto start = std::chrono::steady_clock::now();
+	const std::uint64_t count = solver->solve(board, queue, length, maxHeight);
+	double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+	for (unsigned int i = 0; i < solver->getKeptCount() && i < LISTED_SOLUTIONS; ++i) {
+		const PerfectClear& solution = solver->getSolution(i);
+		std::cout << "  ";
+		for (unsigned int j = 0; j < solution.length; ++j) {
+			const Placement& placement = solution.placements[j];
+			std::cout << PIECE_LETTERS[queue[j]] << " r" << +placement.rotation << " c" << +placement.col << " y" << +placement.row << (j + 1 < solution.length ? ", " : "\n");
+		}
+	}
+
+	std::cout << "Solutions:   " << count << "\n";
+	std::cout << "Threads:     " << solver->getThreadCount() << "\n";
+	std::cout << "Seconds:     " << seconds << "\n";
+	std::cout << "Fields:      " << solver->getStats().nodes << "\n";
+	std::cout << "Fields/sec:  " << solver->getStats().nodesPerSecond() << std::endl;
+
+	return 0;
+
+}
@@ -0,0 +1,200 @@
+#include "gamecore.h"
+#include "movegen.h"
+#include "xoshiro.h"
+#include "config.h"
+#include <array>
+#include <cstdlib>
+#include <iostream>
+#include <memory>
+
+
+using Core = GameCore<CONFIG::BOARD_ROWS, CONFIG::BOARD_COLS>;
+using Generator = MoveGenerator<CONFIG::BOARD_ROWS, CONFIG::BOARD_COLS>;
+
+constexpr unsigned int CHECKED_GAMES = 200;
+constexpr std::uint64_t CHECKED_SEED = 1;
+constexpr unsigned int MAX_PIECES = 200;          // Pieces Per Game Before It's Cut Short
+constexpr unsigned int HINT_ONE_IN = 2;           // How Often A New Piece Gets A Hint
+constexpr unsigned int REPORTED_MISMATCHES = 5;
+
+
+/*
+
+	Desc: Keeps What A Renderer Would Have On Screen, Cell By Cell, From Nothing
+	But The Notifications A GameCore Sends Its Listener.
+
+*/
+class PaintedGrid : public CoreListener
+{
+
+	private:
+
+		std::array<Cell, CONFIG::BOARD_ROWS * CONFIG::BOARD_COLS> cells;
+
+
+	public:
+
+		PaintedGrid()
+		{
+			cells.fill(EMPTY_CELL);
+		}
+
+		void onCellChanged(unsigned int row, unsigned int col, Cell cell) override
+		{
+			cells[row * CONFIG::BOARD_COLS + col] = cell;
+		}
+
+		void onRowMoved(unsigned int fromRow, unsigned int toRow) override
+		{
+			for (unsigned int c = 0; c < CONFIG::BOARD_COLS; ++c) {
+				cells[toRow * CONFIG::BOARD_COLS + c] = cells[fromRow * CONFIG::BOARD_COLS + c];
+			}
+		}
+
+		void onRowCleared(unsigned int row) override
+		{
+			for (unsigned int c = 0; c < CONFIG::BOARD_COLS; ++c) {
+				cells[row * CONFIG::BOARD_COLS + c] = EMPTY_CELL;
+			}
+		}
+
+		Cell get(unsigned int row, unsigned int col) const { return cells[row * CONFIG::BOARD_COLS + col]; }
+
+};
+
+
+/*
+
+	Desc: Counts Of One Run, Split By Whether A Hint Was Showing.
+
+*/
+struct PaintTotals
+{
+
+	std::uint64_t checks[2], mismatches[2];   // [0] Without A Hint, [1] With One
+
+};
+
+
+/*
+
+	Desc: Compares The Painted Grid Against The Core: Every Cell Of The Active
+	Piece's Shape Must Be Painted As One Occupied Cell, And Every Other Cell
+	Exactly As The Core Holds It (Locked, Ghost, Or Empty).
+
+*/
+bool paintedMatches(const Core& core, const PaintedGrid& painted)
+{
+
+	const PieceRotation& shape = PIECE_TABLE.get(core.getActivePiece(), core.getActiveRotation());
+	const unsigned int top = core.getActiveRow(), left = core.getActiveCol();
+	const Cell pieceCell = painted.get(top + shape.cellRow[0], left + shape.cellCol[0]);
+	if (cellState(pieceCell) != OCCUPIED) return false;
+
+	for (unsigned int row = 0; row < CONFIG::BOARD_ROWS; ++row) {
+		for (unsigned int col = 0; col < CONFIG::BOARD_COLS; ++col) {
+			const bool covered = row >= top && row < top + shape.height && col >= left &&
+				((shape.rows[row - top] >> (col - left)) & 1u);
+			if (painted.get(row, col) != (covered ? pieceCell : core.getCell(row, col))) return false;
+		}
+	}
+
+	return true;
+
+}
+
+
+/*
+
+	Usage: tetris_paint [games] [seed]
+
+	Plays games Games (Default 200) From seed (Default 1) With Random Shifts,
+	Turns, Drops, And Hard Drops, Half The Pieces Showing A Hint Toward A Random
+	Reachable Placement, Just As Window Sends Them (Redrawing The Ghost After Each
+	Shift Or Turn). After Every Input The Grid A Renderer Would Have Painted Must
+	Show The Active Piece Whole And Everything Else As The Core Holds It; Fails If
+	It Ever Doesn't.
+
+*/
+int main(int argc, char** argv)
+{
+
+	unsigned int games = argc > 1 ? std::strtoul(argv[1], nullptr, 10) : CHECKED_GAMES;
+	std::uint64_t seed = argc > 2 ? std::strtoull(argv[2], nullptr, 10) : CHECKED_SEED;
+
+	auto core = std::make_unique<Core>(seed);
+	auto painted = std::make_unique<PaintedGrid>();
+	auto generator = std::make_unique<Generator>();
+	core->setListener(painted.get());
+
+	Xoshiro256 rng(seed);
+	PaintTotals totals{};
+
+	for (unsigned int game = 0; game < games; ++game) {
+		core->reset(rng.next());
+
+		while (!core->isGameOver() && core->getPiecesLocked() < MAX_PIECES) {
+			if (!core->isPieceActive())
+			{
+				core->step();
+				if (!core->isPieceActive() || core->isGameOver()) continue;
+
+				// Point A Hint Somewhere The Piece Can Go
+				if (rng.nextBelow(HINT_ONE_IN) == 0)
+				{
+					const unsigned int placements = generator->generate(core->getOccupancy(), core->getActivePiece(),
+						core->getActiveRotation(), core->getActiveRow(), core->getActiveCol());
+					if (placements)
+					{
+						const Placement& hint = generator->getPlacement(rng.nextBelow(placements));
+						core->setHint(hint.rotation, hint.row, hint.col);
+					}
+				}
+			}
+			else
+			{
+				switch (rng.nextBelow(16))
+				{
+					case 0: case 1: case 2: case 3:
+						core->shiftActivePiece('L');
+						core->ghostPiece();
+						break;
+					case 4: case 5: case 6: case 7:
+						core->shiftActivePiece('R');
+						core->ghostPiece();
+						break;
+					case 8: case 9: case 10: case 11:
+						core->rotateActivePiece();
+						core->ghostPiece();
+						break;
+					case 12:
+						core->clearHint();
+						break;
+					case 13:
+						core->shiftActivePiece('D');
+						break;
+					default:
+						core->step();
+						break;
+				}
+			}
+
+			if (!core->isPieceActive() || core->isGameOver()) continue;
+
+			const unsigned int hinted = core->isHintShown() ? 1 : 0;
+			totals.checks[hinted]++;
+			if (!paintedMatches(*core, *painted) && totals.mismatches[hinted]++ < REPORTED_MISMATCHES)
+			{
+				std::cout << "Game " << game << " Piece " << core->getPiecesLocked() << (hinted ? " (Hint)" : "")
+					<< ": Painted Grid Differs From The Core\n";
+			}
+		}
+	}
+
+	std::cout << "Games:          " << games << " (Seed " << seed << ")\n";
+	std::cout << "Without Hint:   " << totals.checks[0] << " Checks, " << totals.mismatches[0] << " Mismatches\n";
+	std::cout << "With Hint:      " << totals.checks[1] << " Checks, " << totals.mismatches[1] << " Mismatches" << std::endl;
+
+	return totals.mismatches[0] || totals.mismatches[1] ? 1 : 0;
+
+}
@@ -0,0 +1,351 @@
+#include "gamecore.h"
+#include "movegen.h"
+#include "piecestream.h"
+#include "config.h"
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <memory>
+#include <string>
+
+
+using Bits = BitBoard<CONFIG::BOARD_ROWS, CONFIG::BOARD_COLS>;
+using Generator = MoveGenerator<CONFIG::BOARD_ROWS, CONFIG::BOARD_COLS>;
+using Core = GameCore<CONFIG::BOARD_ROWS, CONFIG::BOARD_COLS>;
+
+constexpr unsigned int MAX_DEPTH = 8;
+constexpr unsigned int CHECKED_DEPTH = 3;
+constexpr std::uint64_t CHECKED_SEED = 1;
+constexpr unsigned int REPORTED_BAD_PATHS = 5;
+
+
+/*
+
+	Desc: A Starting Board Perft Is Run From. rows Lists The Bottom Of The Board
+	Top Row First ('#' Filled, '.' Empty), Ending On The Floor; Every Row Above Is
+	Empty (Rows Below May Be Empty Too, Leaving The Ones Above Floating). expected Holds The Known Counts Of Depths 1 Through CHECKED_DEPTH When
+	Dealt From CHECKED_SEED, So Move Generator Changes Which Alter Them Get Caught.
+
+*/
+struct ReferenceBoard
+{
+
+	const char* name;
+	std::array<const char*, 8> rows;
+	std::array<std::uint64_t, CHECKED_DEPTH> expected;
+
+};
+
+
+const ReferenceBoard REFERENCE_BOARDS[] =
+{
+
+	{ "empty", {}, { 34, 591, 20899 } },
+
+	{ "midgame", {
+		"......#...",
+		"#....###..",
+		"##..######",
+		"###.######",
+		"####.#####",
+		"#.########" }, { 34, 586, 20949 } },
+
+	{ "overhang", {
+		"##........",
+		"##....####",
+		"......####",
+		"#.....####",
+		"###.######",
+		"###.######" }, { 38, 707, 26968 } },
+
+	{ "tslot", {
+		"###.......",
+		"##...#####",
+		"###.######",
+		"####.#####",
+		"#####.####" }, { 35, 606, 21413 } },
+
+	{ "tall", {
+		".#########",
+		"#########.",
+		".#########",
+		"#########.",
+		".#########",
+		"#########.",
+		".#########",
+		"#########." }, { 34, 591, 20872 } },
+
+	// A Loaded Puzzle May Float Rows Over Empty Ones; Clearing Below Must Drop Them Too
+	{ "floating", {
+		"#####.....",
+		"..........",
+		"..........",
+		"#########." }, { 45, 887, 35244 } }
+
+};
+
+
+/*
+
+	Desc: Builds A Bit Board From A Reference Board's Rows.
+
+*/
+Bits loadBoard(const ReferenceBoard& reference)
+{
+
+	unsigned int height = 0;
+	while (height < reference.rows.size() && reference.rows[height]) ++height;
+
+	Bits board;
+	for (unsigned int i = 0; i < height; ++i) {
+		const unsigned int row = CONFIG::BOARD_ROWS - height + i;
+		for (unsigned int col = 0; col < CONFIG::BOARD_COLS && reference.rows[i][col]; ++col) {
+			if (reference.rows[i][col] == '#')
+			{
+				const std::uint16_t cell = static_cast<std::uint16_t>(1u << col);
+				board.place(&cell, 1, row, 0);
+			}
+		}
+	}
+
+	return board;
+
+}
+
+
+/*
+
+	Desc: Counts Every Sequence Of Placements Reachable Over depth Pieces, Keeping
+	One MoveGenerator Per Depth So Nothing Is Allocated While Searching. The Last
+	Depth Is Bulk Counted Straight From The Generator Without Being Played Out.
+
+*/
+class Perft
+{
+
+	private:
+
+		std::array<Generator, MAX_DEPTH> generators;
+		std::array<unsigned int, MAX_DEPTH> pieces;
+		std::array<std::uint64_t, MAX_DEPTH> counts;
+		unsigned int depth;
+
+
+		void search(const Bits& board, unsigned int ply)
+		{
+
+			Generator& generator = generators[ply];
+			const unsigned int placements = generator.generate(board, pieces[ply]);
+			counts[ply] += placements;
+
+			if (ply + 1 == depth) return;
+
+			for (unsigned int i = 0; i < placements; ++i) {
+				Bits child = board;
+				applyPlacement(child, pieces[ply], generator.getPlacement(i));
+				search(child, ply + 1);
+			}
+
+		}
+
+
+	public:
+
+		std::array<std::uint64_t, MAX_DEPTH> run(const Bits& board, std::uint64_t seed, unsigned int newDepth)
+		{
+
+			depth = newDepth;
+			counts.fill(0);
+
+			// Same Pieces A GameCore Seeded With seed Would Deal
+			PieceStream stream(seed);
+			for (unsigned int ply = 0; ply < depth; ++ply) {
+				pieces[ply] = stream.deal();
+			}
+
+			search(board, 0);
+			return counts;
+
+		}
+
+};
+
+
+/*
+
+	Desc: Walks The Same Placement Sequences As Perft Through A GameCore As Well,
+	Playing Each Placement's getPath From The Spawn. Every Placement Must Fit And
+	Rest On Its Board, Its Path Must Leave The Game's Active Piece Exactly On It,
+	And The Next step Must Lock It, Leaving The Game's Cells & Hash Equal To What
+	applyPlacement Gives. Not Timed, Since Every Leaf Is Played Out.
+
+*/
+class PathCheck
+{
+
+	private:
+
+		std::array<Generator, MAX_DEPTH> generators;
+		std::array<char, Generator::MAX_PATH_LENGTH> path;
+		std::uint64_t checked, bad;
+		unsigned int depth;
+
+
+		bool checkPlacement(const Bits& board, const Core& core, const Placement& placement, unsigned int length, Bits& child, Core& game)
+		{
+
+			const unsigned int piece = core.getNextPiece();
+			const PieceRotation& shape = PIECE_TABLE.get(piece, placement.rotation);
+			bool valid = !board.collides(shape.rows, shape.height, placement.row, placement.col) &&
+				board.collides(shape.rows, shape.height, placement.row + 1, placement.col);
+
+			// Spawn, Follow The Path, Then Lock
+			game = core;
+			game.step();
+			playPath(game, path.data(), length);
+			valid = valid && game.isPieceActive() && game.getActiveRotation() == placement.rotation &&
+				game.getActiveRow() == placement.row && game.getActiveCol() == placement.col;
+			game.step();
+
+			child = board;
+			applyPlacement(child, piece, placement);
+			valid = valid && !game.isPieceActive() && game.getHash() == hashBoard(child);
+			for (unsigned int row = 0; row < CONFIG::BOARD_ROWS && valid; ++row) {
+				valid = game.getOccupancy().getRow(row) == child.getRow(row);
+			}
+
+			return valid;
+
+		}
+
+
+		void search(const Bits& board, const Core& core, unsigned int ply)
+		{
+
+			Generator& generator = generators[ply];
+			const unsigned int placements = generator.generate(board, core.getNextPiece());
+
+			for (unsigned int i = 0; i < placements; ++i) {
+				const Placement& placement = generator.getPlacement(i);
+				const unsigned int length = generator.getPath(placement, path.data());
+
+				Bits child;
+				Core game;
+				checked++;
+				if (!checkPlacement(board, core, placement, length, child, game))
+				{
+					if (bad++ < REPORTED_BAD_PATHS)
+					{
+						std::cout << "  Bad Path At Depth " << ply + 1 << ": Piece " << core.getNextPiece() << " To ("
+							<< +placement.rotation << ", " << +placement.row << ", " << +placement.col << ") Via \""
+							<< std::string(path.data(), length) << "\"\n";
+					}
+					continue;
+				}
+
+				if (ply + 1 < depth) search(child, game, ply + 1);
+			}
+
+		}
+
+
+	public:
+
+		// Returns How Many Placements Were Checked, And How Many Failed Into bad
+		std::uint64_t run(const Bits& board, std::uint64_t seed, unsigned int newDepth, std::uint64_t& badOut)
+		{
+
+			depth = newDepth;
+			checked = 0;
+			bad = 0;
+
+			// A GameCore Seeded With seed Deals The Same Pieces Perft Searches
+			Core core(seed);
+			core.loadBoard(board, makeCell(OCCUPIED, PALETTE_FIRST_PIECE));
+			search(board, core, 0);
+
+			badOut = bad;
+			return checked;
+
+		}
+
+};
+
+
+/*
+
+	Usage: tetris_perft [depth] [seed] [board]
+
+	Counts The Placement Sequences Reachable Over depth Pieces (Default 3, At Most
+	8) Dealt From seed (Default 1) On A Reference Board (Default: All Of Them),
+	Printing Per-Depth Counts & Nodes Per Second. Runs At The Checked Depth & Seed
+	Also Compare Against The Known Counts, Failing If Any Differ. Every Placement
+	Over The First CHECKED_DEPTH Pieces Is Then Played Out Through A GameCore Along
+	Its Path, Failing If Any Path Doesn't End On Its Placement (See PathCheck).
+
+*/
+int main(int argc, char** argv)
+{
+
+	unsigned int depth = argc > 1 ? std::strtoul(argv[1], nullptr, 10) : CHECKED_DEPTH;
+	std::uint64_t seed = argc > 2 ? std::strtoull(argv[2], nullptr, 10) : CHECKED_SEED;
+	const char* only = argc > 3 ? argv[3] : nullptr;
+
+	if (depth < 1 || depth > MAX_DEPTH)
+	{
+		std::cerr << "Depth Must Be Between 1 And " << MAX_DEPTH << std::endl;
+		return 1;
+	}
+
+	auto perft = std::make_unique<Perft>();
+	auto pathCheck = std::make_unique<PathCheck>();
+	bool failed = false, ran = false;
+
+	for (const ReferenceBoard& reference : REFERENCE_BOARDS) {
+		if (only && std::strcmp(only, reference.name) != 0) continue;
+		ran = true;
+
+		auto start = std::chrono::steady_clock::now();
+		std::array<std::uint64_t, MAX_DEPTH> counts = perft->run(loadBoard(reference), seed, depth);
+		double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+		std::uint64_t nodes = 0;
+		std::cout << reference.name << " (Seed " << seed << ")\n";
+		for (unsigned int ply = 0; ply < depth; ++ply) {
+			nodes += counts[ply];
+			std::cout << "  Depth " << ply + 1 << ":  " << counts[ply];
+
+			if (seed == CHECKED_SEED && ply < CHECKED_DEPTH)
+			{
+				bool matches = counts[ply] == reference.expected[ply];
+				failed = failed || !matches;
+				std::cout << (matches ? "  (ok)" : "  (EXPECTED ");
+				if (!matches) std::cout << reference.expected[ply] << ")";
+			}
+			std::cout << "\n";
+		}
+		std::cout << "  Nodes:      " << nodes << "\n";
+		std::cout << "  Seconds:    " << seconds << "\n";
+		std::cout << "  Nodes/sec:  " << (seconds > 0.0 ? nodes / seconds : 0.0) << std::endl;
+
+		std::uint64_t bad = 0;
+		std::uint64_t paths = pathCheck->run(loadBoard(reference), seed, std::min(depth, CHECKED_DEPTH), bad);
+		failed = failed || bad;
+		std::cout << "  Paths:      " << paths;
+		if (bad) std::cout << "  (" << bad << " BAD)";
+		else std::cout << "  (ok)";
+		std::cout << std::endl;
+	}
+
+	if (!ran)
+	{
+		std::cerr << "No Reference Board Named " << only << std::endl;
+		return 1;
+	}
+
+	return failed ? 1 : 0;
+
+}
@@ -0,0 +1,83 @@
+#include "rollout.h"
+#include "gamecore.h"
+#include "movegen.h"
+#include "config.h"
+#include <chrono>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <memory>
+
+
+/*
+
+	Usage: tetris_rollout [pieces] [rollouts] [depth] [threads] [seed] [random|greedy]
+
+	Plays Headless Games (Starting Over On Each Game Over) Until pieces Pieces Are
+	Placed, Choosing Each Placement By RolloutEvaluator With rollouts Continuations
+	Of depth Pieces Per Candidate Across threads Threads (Default: Every Core), Then
+	Reports Rollouts Per Second, Since That's What Decides How Many The Evaluator
+	Can Afford Per Piece.
+
+*/
+int main(int argc, char** argv)
+{
+
+	unsigned int pieces = argc > 1 ? std::strtoul(argv[1], nullptr, 10) : 200;
+	unsigned int rollouts = argc > 2 ? std::strtoul(argv[2], nullptr, 10) : CONFIG::ROLLOUT_COUNT;
+	unsigned int depth = argc > 3 ? std::strtoul(argv[3], nullptr, 10) : CONFIG::ROLLOUT_DEPTH;
+	unsigned int threads = argc > 4 ? std::strtoul(argv[4], nullptr, 10) : std::thread::hardware_concurrency();
+	std::uint64_t seed = argc > 5 ? std::strtoull(argv[5], nullptr, 10) : 1;
+	RolloutPolicy policy = argc > 6 && !std::strcmp(argv[6], "random") ? RolloutPolicy::RANDOM : RolloutPolicy::GREEDY;
+
+	using Core = GameCore<CONFIG::BOARD_ROWS, CONFIG::BOARD_COLS>;
+	using Evaluator = RolloutEvaluator<CONFIG::BOARD_ROWS, CONFIG::BOARD_COLS>;
+	auto core = std::make_unique<Core>(seed);
+	auto evaluator = std::make_unique<Evaluator>(rollouts, depth, policy, threads);
+
+	char path[Evaluator::Generator::MAX_PATH_LENGTH];
+	std::uint64_t lines = 0, placed = 0;
+	unsigned int games = 1;
+	auto start = std::chrono::steady_clock::now();
+
+	while (placed < pieces) {
+
+		// Spawn, Place, And Lock One Piece
+		core->step();
+		if (core->isGameOver())
+		{
+			lines += core->getLinesCleared();
+			core->reset(seed + games++);
+			continue;
+		}
+
+		const unsigned int next = core->getNextPiece();
+		evaluator->evaluate(core->getOccupancy(), core->getActivePiece(), core->getActiveRotation(), core->getActiveRow(), core->getActiveCol(), &next, 1, seed + placed);
+
+		const int best = evaluator->getBest();
+		if (best >= 0)
+		{
+			playPath(*core, path, evaluator->getGenerator().getPath(evaluator->getPlacement(best), path));
+		}
+		core->step();
+		placed++;
+	}
+	lines += core->getLinesCleared();
+
+	double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+	const RolloutStats& stats = evaluator->getStats();
+
+	std::cout << "Rollouts:       " << evaluator->getRolloutCount() << " x " << evaluator->getRolloutDepth() << " Pieces ("
+		<< (evaluator->getPolicy() == RolloutPolicy::RANDOM ? "Random" : "Greedy") << ") On " << evaluator->getThreadCount() << " Threads\n";
+	std::cout << "Games:          " << games << "\n";
+	std::cout << "Pieces:         " << placed << "\n";
+	std::cout << "Lines:          " << lines << "\n";
+	std::cout << "Seconds:        " << seconds << "\n";
+	std::cout << "Pieces/sec:     " << (seconds > 0.0 ? placed / seconds : 0.0) << "\n";
+	std::cout << "Played:         " << stats.rollouts << " Rollouts, " << stats.placements << " Placements\n";
+	std::cout << "Rollouts/sec:   " << stats.rolloutsPerSecond() << "\n";
+	std::cout << "Placements/sec: " << stats.placementsPerSecond() << std::endl;
+
+	return 0;
+
+}
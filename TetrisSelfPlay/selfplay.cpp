@@ -0,0 +1,235 @@
+#include "batchsim.h"
+#include "evaluator.h"
+#include "movegen.h"
+#include "shards.h"
+#include "xoshiro.h"
+#include "config.h"
+#include <cstdlib>
+#include <iostream>
+#include <limits>
+#include <string>
+#include <vector>
+
+
+using Core = GameCore<CONFIG::BOARD_ROWS, CONFIG::BOARD_COLS>;
+using Generator = MoveGenerator<CONFIG::BOARD_ROWS, CONFIG::BOARD_COLS>;
+using Bits = BitBoard<CONFIG::BOARD_ROWS, CONFIG::BOARD_COLS>;
+
+
+/*
+
+	Desc: BatchSimulator Policy Playing Like The Bot: Every Reachable Placement Of
+	The Active Piece Is Scored By The Best Board evaluateBoard() Finds After The
+	Preview Piece, Except That With Chance exploration A Placement Is Picked At
+	Random. Each Position Is Kept Until Its Game Ends, When The Outcome Is Filled In
+	And The Whole Game Goes To The ShardWriter In One append().
+
+*/
+class SelfPlayPolicy
+{
+
+	private:
+
+		ShardWriter* writer;
+		EvalWeights weights;
+		float exploration;
+
+		Generator rootGenerator, leafGenerator;
+
+		// Positions Of The Game So Far; Until It Ends, linesAfter & piecesAfter Hold The Totals Before Each
+		std::vector<TrainingRecord> game;
+
+
+		/*
+
+			Desc: Finds The Placement Of rootGenerator Leading To The Best Board After The Preview.
+
+			Preconditions:
+				1.) rootGenerator Holds count Placements Of core's Active Piece.
+
+			Postconditions:
+				1.) Returns The Chosen Placement's Index.
+
+		*/
+		unsigned int choose(const Core& core, unsigned int count)
+		{
+
+			float best = std::numeric_limits<float>::lowest();
+			unsigned int bestIndex = 0;
+			for (unsigned int i = 0; i < count; ++i) {
+				Bits board = core.getOccupancy();
+				const unsigned int lines = applyPlacement(board, core.getActivePiece(), rootGenerator.getPlacement(i));
+
+				float score = CONFIG::ROLLOUT_TOP_OUT_SCORE;
+				const unsigned int leaves = leafGenerator.generate(board, core.getNextPiece());
+				for (unsigned int j = 0; j < leaves; ++j) {
+					Bits leaf = board;
+					const unsigned int leafLines = applyPlacement(leaf, core.getNextPiece(), leafGenerator.getPlacement(j));
+					score = std::max(score, evaluateBoard(leaf, lines + leafLines, weights));
+				}
+
+				if (score > best)
+				{
+					best = score;
+					bestIndex = i;
+				}
+			}
+			return bestIndex;
+
+		}
+
+
+	public:
+
+		SelfPlayPolicy(ShardWriter& newWriter, float newExploration, const EvalWeights& newWeights = DEFAULT_WEIGHTS)
+			: writer(&newWriter), weights(newWeights), exploration(newExploration)
+		{
+		}
+
+		SelfPlayPolicy(const SelfPlayPolicy& other)
+			: writer(other.writer), weights(other.weights), exploration(other.exploration)
+		{
+		}
+
+
+		// Places A Freshly Spawned Piece, Keeping The Position
+		void operator()(Core& core, Xoshiro256& rng)
+		{
+
+			const unsigned int count = rootGenerator.generate(core.getOccupancy(), core.getActivePiece(), core.getActiveRotation(), core.getActiveRow(), core.getActiveCol());
+			if (!count) return;
+
+			const bool explored = rng.nextFloat() < exploration;
+			const Placement& placement = rootGenerator.getPlacement(explored ? rng.nextBelow(count) : choose(core, count));
+
+			TrainingRecord record{};
+			for (unsigned int row = 0; row < CONFIG::BOARD_ROWS; ++row) {
+				record.rows[row] = static_cast<std::uint16_t>(core.getOccupancy().getRow(row));
+			}
+			record.piece = static_cast<std::uint8_t>(core.getActivePiece());
+			record.rotation = placement.rotation;
+			record.row = placement.row;
+			record.col = placement.col;
+			record.linesAfter = core.getLinesCleared();
+			record.piecesAfter = core.getPiecesLocked();
+			record.explored = explored;
+			game.push_back(record);
+
+			char path[Generator::MAX_PATH_LENGTH];
+			playPath(core, path, rootGenerator.getPath(placement, path));
+
+		}
+
+
+		// Fills In How Each Position's Game Went, Then Hands The Game To The Writer
+		void gameOver(const Core& core)
+		{
+
+			for (TrainingRecord& record : game) {
+				record.linesAfter = core.getLinesCleared() - record.linesAfter;
+				record.piecesAfter = core.getPiecesLocked() - record.piecesAfter;
+				record.toppedOut = core.isGameOver();
+			}
+
+			// A Position Whose Piece Never Locked Didn't Happen
+			while (!game.empty() && !game.back().piecesAfter) game.pop_back();
+
+			writer->append(game.data(), static_cast<unsigned int>(game.size()));
+			game.clear();
+
+		}
+
+};
+
+
+/*
+
+	Desc: Tests Whether A Record Read Back Is One Self-Play Could Have Written: A Real
+	Piece And Rotation, Placed Inside The Board Clear Of Its Locked Cells, And Locked
+	Before Its Game Ended.
+
+*/
+bool recordValid(const TrainingRecord& record)
+{
+
+	if (record.piece >= PIECE_COUNT || record.rotation >= ROTATION_COUNT || !record.piecesAfter) return false;
+
+	const PieceRotation& shape = PIECE_TABLE.get(record.piece, record.rotation);
+	if (record.row + shape.height > CONFIG::BOARD_ROWS || record.col + shape.width > CONFIG::BOARD_COLS) return false;
+	for (unsigned int r = 0; r < shape.height; ++r) {
+		if ((static_cast<std::uint32_t>(shape.rows[r]) << record.col) & record.rows[record.row + r]) return false;
+	}
+	return true;
+
+}
+
+
+/*
+
+	Usage: tetris_selfplay [directory] [boards] [gamesPerBoard] [threads] [seed] [exploration]
+
+	Plays gamesPerBoard Bot Games On Each Of boards Boards Across threads Threads
+	(Default: Every Core) With BatchSimulator, Streaming Every Position (Board,
+	Piece, Placement, And How The Game Went From There) Into Compressed Shards Under
+	directory (Default CONFIG::SELFPLAY_DIRECTORY), Written By ShardWriter's Own
+	Thread. Running Again Appends To The Same Directory. Reports Positions Per
+	Second And How Long The Simulation Ever Waited On The Writer, Then Reads Every
+	Record Of The Directory Back Through The Index, Failing If Any Is Bad.
+
+*/
+int main(int argc, char** argv)
+{
+
+	const std::string directory = argc > 1 ? argv[1] : CONFIG::SELFPLAY_DIRECTORY;
+	unsigned int boards = argc > 2 ? std::strtoul(argv[2], nullptr, 10) : 64;
+	unsigned int gamesPerBoard = argc > 3 ? std::strtoul(argv[3], nullptr, 10) : 1;
+	unsigned int threads = argc > 4 ? std::strtoul(argv[4], nullptr, 10) : std::thread::hardware_concurrency();
+	std::uint64_t seed = argc > 5 ? std::strtoull(argv[5], nullptr, 10) : 1;
+	float exploration = argc > 6 ? std::strtof(argv[6], nullptr) : CONFIG::SELFPLAY_EXPLORATION;
+
+	ShardWriter writer(directory);
+	if (writer.hasFailed())
+	{
+		std::cerr << "Couldn't Open Shard Directory " << directory << std::endl;
+		return 1;
+	}
+
+	BatchSimulator<CONFIG::BOARD_ROWS, CONFIG::BOARD_COLS> simulator(boards, seed, threads);
+	BatchStats stats = simulator.run(gamesPerBoard, SelfPlayPolicy(writer, exploration));
+	writer.close();
+
+	if (writer.hasFailed())
+	{
+		std::cerr << "Failed Writing Shards To " << directory << std::endl;
+		return 1;
+	}
+
+	const ShardStats& written = writer.getStats();
+	std::cout << "Boards:            " << simulator.getBoardCount() << " On " << simulator.getThreadCount() << " Threads\n";
+	std::cout << "Games:             " << stats.games << "\n";
+	std::cout << "Positions:         " << written.records << " In " << written.blocks << " Blocks Over " << written.shards << " Shards\n";
+	std::cout << "Bytes:             " << written.compressedBytes << " (" << written.compressionRatio() << "x Smaller)\n";
+	std::cout << "Seconds:           " << stats.seconds << "\n";
+	std::cout << "Positions/sec:     " << stats.piecesPerSecond() << "\n";
+	std::cout << "Writer Stalls:     " << written.stallSeconds << " Seconds" << std::endl;
+
+	// Read The Whole Directory Back Through Its Index, In Order So Each Block Is Decompressed Once
+	ShardReader reader;
+	if (!reader.open(directory))
+	{
+		std::cerr << "Couldn't Open The Index Of " << directory << std::endl;
+		return 1;
+	}
+
+	std::uint64_t bad = 0;
+	for (std::uint64_t number = 0; number < reader.getRecordCount(); ++number) {
+		TrainingRecord record;
+		if (!reader.read(number, record) || !recordValid(record)) bad++;
+	}
+
+	std::cout << "Indexed Positions: " << reader.getRecordCount() << " In " << reader.getBlockCount() << " Blocks\n";
+	std::cout << "Bad Records:       " << bad << " Of " << reader.getRecordCount() << std::endl;
+
+	return bad ? 1 : 0;
+
+}
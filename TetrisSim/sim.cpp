@@ -0,0 +1,36 @@
+#include "batchsim.h"
+#include "config.h"
+#include <cstdlib>
+#include <iostream>
+
+
+/*
+
+	Usage: tetris_sim [boards] [gamesPerBoard] [threads] [seed]
+
+	Plays gamesPerBoard Headless Games On Each Of boards Boards Across threads
+	Threads (Default: Every Core), Then Reports Games & Pieces Per Second.
+
+*/
+int main(int argc, char** argv)
+{
+
+	unsigned int boards = argc > 1 ? std::strtoul(argv[1], nullptr, 10) : 4096;
+	unsigned int gamesPerBoard = argc > 2 ? std::strtoul(argv[2], nullptr, 10) : 4;
+	unsigned int threads = argc > 3 ? std::strtoul(argv[3], nullptr, 10) : std::thread::hardware_concurrency();
+	std::uint64_t seed = argc > 4 ? std::strtoull(argv[4], nullptr, 10) : 1;
+
+	BatchSimulator<CONFIG::BOARD_ROWS, CONFIG::BOARD_COLS> simulator(boards, seed, threads);
+	BatchStats stats = simulator.run(gamesPerBoard);
+
+	std::cout << "Boards:      " << simulator.getBoardCount() << " On " << simulator.getThreadCount() << " Threads\n";
+	std::cout << "Games:       " << stats.games << "\n";
+	std::cout << "Pieces:      " << stats.pieces << "\n";
+	std::cout << "Lines:       " << stats.lines << "\n";
+	std::cout << "Seconds:     " << stats.seconds << "\n";
+	std::cout << "Games/sec:   " << stats.gamesPerSecond() << "\n";
+	std::cout << "Pieces/sec:  " << stats.piecesPerSecond() << std::endl;
+
+	return 0;
+
+}
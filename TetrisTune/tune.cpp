@@ -0,0 +1,365 @@
+#include "bot.h"
+#include "evaluator.h"
+#include "gamecore.h"
+#include "workpool.h"
+#include "xoshiro.h"
+#include "config.h"
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <cmath>
+#include <cstdlib>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <memory>
+#include <vector>
+
+
+using Core = GameCore<CONFIG::BOARD_ROWS, CONFIG::BOARD_COLS>;
+using TuneBot = Bot<CONFIG::BOARD_ROWS, CONFIG::BOARD_COLS>;
+
+
+/*
+
+	Desc: One Weight Vector Being Evolved And The Mean Score It Last Played For.
+
+*/
+struct Candidate
+{
+
+	EvalWeights weights;
+	double fitness;
+
+};
+
+
+/*
+
+	Desc: Scales Weights To Unit Length. A Bot Only Compares Scores, So Only The
+	Direction Of A Weight Vector Matters, And Keeping Them The Same Length Stops
+	Crossover & Mutation From Drifting In Scale.
+
+*/
+EvalWeights normalized(EvalWeights weights)
+{
+
+	float length = 0.0f;
+	for (float weight : weights) length += weight * weight;
+	length = std::sqrt(length);
+
+	if (length > 0.0f)
+	{
+		for (float& weight : weights) weight /= length;
+	}
+	return weights;
+
+}
+
+
+/*
+
+	Desc: Seed Of One Game Of A Generation; Every Candidate Plays The Same Seeds.
+
+*/
+std::uint64_t gameSeed(std::uint64_t seed, unsigned int generation, unsigned int game)
+{
+
+	Xoshiro256 mix(seed ^ (std::uint64_t(generation) << 32) ^ game);
+	return mix.next();
+
+}
+
+
+/*
+
+	Desc: Evolves Bot Evaluation Weights. Each Generation Every Candidate Plays The
+	Same Seeded Headless Games Through GameCore With The Interactive Bot's Beam,
+	Spread Across A Work-Stealing WorkPool With One Single-Threaded Bot & GameCore
+	Per Worker (Without A Transposition Table, Since Every Game Brings New Weights).
+	A Game's Fitness Is Its Headroom (Empty Rows Above The Stack) Summed Over Every
+	Piece Locked: Lasting Longer And Keeping The Stack Lower Both Count, So Candidates
+	Good Enough To Reach TUNE_MAX_PIECES Are Still Told Apart, Where The Game's Score
+	(Lines Cleared) Would Have Them All Near The Same Ceiling. The Best Survive, And The Rest Are Replaced
+	By Children Blended From Two Tournament-Picked Parents, Weighted By Fitness,
+	Then Mutated. The Population Is Checkpointed After Every Generation.
+
+*/
+class Tuner
+{
+
+	private:
+
+		WorkPool pool;
+		std::vector<std::unique_ptr<TuneBot>> bots;
+		std::vector<std::unique_ptr<Core>> cores;
+
+		std::vector<Candidate> population;
+		std::vector<std::uint64_t> gameFitness;
+		std::uint64_t seed;
+		unsigned int generation;
+
+
+		// Empty Rows Above The Highest Locked Cell
+		static unsigned int headroom(const Core& core)
+		{
+			unsigned int row = 0;
+			while (row < Core::getRows() && !core.getOccupancy().getRow(row)) ++row;
+			return row;
+		}
+
+
+		/*
+
+			Desc: Plays One Game Of One Candidate On worker's Bot & Core, Scoring Its Fitness.
+
+		*/
+		void playGame(unsigned int task, unsigned int worker)
+		{
+
+			const unsigned int candidate = task / CONFIG::TUNE_GAMES_PER_CANDIDATE;
+			const unsigned int game = task % CONFIG::TUNE_GAMES_PER_CANDIDATE;
+
+			TuneBot& bot = *bots[worker];
+			Core& core = *cores[worker];
+			bot.setWeights(population[candidate].weights);
+			core.reset(gameSeed(seed, generation, game));
+
+			std::uint64_t fitness = 0;
+			while (core.getPiecesLocked() < CONFIG::TUNE_MAX_PIECES) {
+				core.step();
+				if (core.isGameOver()) break;
+
+				bot.playPiece(core, core);
+				core.step();
+				fitness += headroom(core);
+			}
+
+			gameFitness[task] = fitness;
+
+		}
+
+
+		/*
+
+			Desc: Picks The Fittest Of A Few Random Candidates.
+
+		*/
+		const Candidate& tournament(Xoshiro256& rng) const
+		{
+
+			const Candidate* best = &population[rng.nextBelow(static_cast<std::uint32_t>(population.size()))];
+			for (unsigned int i = 1; i < 3; ++i) {
+				const Candidate& other = population[rng.nextBelow(static_cast<std::uint32_t>(population.size()))];
+				if (other.fitness > best->fitness) best = &other;
+			}
+			return *best;
+
+		}
+
+
+	public:
+
+		Tuner(unsigned int threads, std::uint64_t newSeed)
+			: pool(threads), population(CONFIG::TUNE_POPULATION), gameFitness(CONFIG::TUNE_POPULATION * CONFIG::TUNE_GAMES_PER_CANDIDATE),
+			seed(newSeed), generation(0)
+		{
+
+			for (unsigned int worker = 0; worker < pool.getThreadCount(); ++worker) {
+				bots.push_back(std::make_unique<TuneBot>(CONFIG::BOT_BEAM_WIDTH, 1, DEFAULT_WEIGHTS, 0));
+				cores.push_back(std::make_unique<Core>());
+			}
+
+			// Start From Our Current Defaults Plus Random Directions
+			Xoshiro256 rng(seed);
+			population[0].weights = normalized(DEFAULT_WEIGHTS);
+			for (unsigned int i = 1; i < population.size(); ++i) {
+				for (float& weight : population[i].weights) weight = rng.nextFloat() * 2.0f - 1.0f;
+				population[i].weights = normalized(population[i].weights);
+			}
+			for (Candidate& candidate : population) candidate.fitness = 0.0;
+
+		}
+
+
+		/*
+
+			Desc: Plays Every Candidate's Games, Then Breeds The Next Generation.
+
+			Preconditions:
+				1.) None
+
+			Postconditions:
+				1.) Returns The Best Candidate Of The Generation Just Played.
+				2.) The Population Holds The Next Generation (Survivors First).
+
+		*/
+		Candidate runGeneration()
+		{
+
+			pool.parallelFor(static_cast<unsigned int>(gameFitness.size()), [this](unsigned int task, unsigned int worker) { playGame(task, worker); });
+
+			for (unsigned int i = 0; i < population.size(); ++i) {
+				double total = 0.0;
+				for (unsigned int game = 0; game < CONFIG::TUNE_GAMES_PER_CANDIDATE; ++game) {
+					total += static_cast<double>(gameFitness[i * CONFIG::TUNE_GAMES_PER_CANDIDATE + game]);
+				}
+				population[i].fitness = total / CONFIG::TUNE_GAMES_PER_CANDIDATE;
+			}
+
+			std::sort(population.begin(), population.end(), [](const Candidate& a, const Candidate& b) { return a.fitness > b.fitness; });
+			Candidate best = population[0];
+
+			// Breeding Is Seeded Per Generation So A Resumed Run Breeds The Same Way
+			Xoshiro256 rng(seed ^ (0x9E3779B97F4A7C15ull * (generation + 1)));
+			std::vector<Candidate> next(population.begin(), population.begin() + CONFIG::TUNE_SURVIVORS);
+			while (next.size() < population.size()) {
+				const Candidate& a = tournament(rng);
+				const Candidate& b = tournament(rng);
+
+				const double total = a.fitness + b.fitness;
+				const float share = total > 0.0 ? static_cast<float>(a.fitness / total) : 0.5f;
+
+				Candidate child{};
+				for (unsigned int feature = 0; feature < FEATURE_COUNT; ++feature) {
+					child.weights[feature] = share * a.weights[feature] + (1.0f - share) * b.weights[feature];
+					if (rng.nextFloat() < CONFIG::TUNE_MUTATION_RATE)
+					{
+						child.weights[feature] += (rng.nextFloat() * 2.0f - 1.0f) * CONFIG::TUNE_MUTATION_SIZE;
+					}
+				}
+				child.weights = normalized(child.weights);
+				next.push_back(child);
+			}
+
+			population.swap(next);
+			generation++;
+			return best;
+
+		}
+
+
+		/*
+
+			Desc: Writes The Seed, Generation, And Population To path. The File Is
+			Written Beside path First And Then Moved Over It, So Stopping Mid-Write
+			Never Leaves A Broken Checkpoint.
+
+			Preconditions:
+				1.) None
+
+			Postconditions:
+				1.) Returns True If path Now Holds The Current State.
+
+		*/
+		bool save(const std::string& path) const
+		{
+
+			const std::string temporary = path + ".tmp";
+			{
+				std::ofstream file(temporary);
+				if (!file) return false;
+
+				file.precision(9);
+				file << seed << " " << generation << " " << population.size() << "\n";
+				for (const Candidate& candidate : population) {
+					for (float weight : candidate.weights) file << weight << " ";
+					file << candidate.fitness << "\n";
+				}
+				if (!file) return false;
+			}
+
+			std::error_code error;
+			std::filesystem::rename(temporary, path, error);
+			return !error;
+
+		}
+
+
+		/*
+
+			Desc: Picks Up Where A Checkpoint Written By save Left Off.
+
+			Preconditions:
+				1.) None
+
+			Postconditions:
+				1.) Returns True And Restores The Seed, Generation, And Population If path Held A Checkpoint.
+				2.) Returns False, Changing Nothing, Otherwise.
+
+		*/
+		bool load(const std::string& path)
+		{
+
+			std::ifstream file(path);
+			std::uint64_t savedSeed;
+			unsigned int savedGeneration;
+			std::size_t savedSize;
+			if (!(file >> savedSeed >> savedGeneration >> savedSize) || savedSize != population.size()) return false;
+
+			std::vector<Candidate> saved(savedSize);
+			for (Candidate& candidate : saved) {
+				for (float& weight : candidate.weights) file >> weight;
+				file >> candidate.fitness;
+			}
+			if (!file) return false;
+
+			seed = savedSeed;
+			generation = savedGeneration;
+			population.swap(saved);
+			return true;
+
+		}
+
+
+		// Getters
+		unsigned int getGeneration() const { return generation; }
+		unsigned int getThreadCount() const { return pool.getThreadCount(); }
+
+};
+
+
+/*
+
+	Usage: tetris_tune [generations] [checkpoint] [threads] [seed]
+
+	Evolves Bot Weights For generations More Generations (Default 100) Across threads
+	Threads (Default: Every Core), Resuming From checkpoint (Default CONFIG's) If It
+	Exists And Saving To It After Every Generation. Each Generation Prints Its Best
+	Candidate's Weights In CONFIG::BOT_WEIGHTS Order And The Running Generations/Hour.
+
+*/
+int main(int argc, char** argv)
+{
+
+	unsigned int generations = argc > 1 ? std::strtoul(argv[1], nullptr, 10) : 100;
+	std::string checkpoint = argc > 2 ? argv[2] : CONFIG::TUNE_CHECKPOINT_FILE;
+	unsigned int threads = argc > 3 ? std::strtoul(argv[3], nullptr, 10) : std::thread::hardware_concurrency();
+	std::uint64_t seed = argc > 4 ? std::strtoull(argv[4], nullptr, 10) : 1;
+
+	Tuner tuner(threads, seed);
+	if (tuner.load(checkpoint))
+	{
+		std::cout << "Resuming From " << checkpoint << " At Generation " << tuner.getGeneration() << "\n";
+	}
+	std::cout << "Tuning On " << tuner.getThreadCount() << " Threads\n";
+
+	auto start = std::chrono::steady_clock::now();
+	for (unsigned int run = 1; run <= generations; ++run) {
+		Candidate best = tuner.runGeneration();
+
+		if (!tuner.save(checkpoint))
+		{
+			std::cerr << "Couldn't Write Checkpoint " << checkpoint << std::endl;
+		}
+
+		double hours = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count() / 3600.0;
+
+		std::cout << "Generation " << tuner.getGeneration() << ":  Best " << best.fitness << "  Weights";
+		for (float weight : best.weights) std::cout << " " << weight;
+		std::cout << "  (" << run / hours << " Generations/Hour)" << std::endl;
+	}
+
+	return 0;
+
+}